@@ -0,0 +1,198 @@
+/*
+* Checks the moves of StrategyExecutor against the output functions of the
+* synthesized transducers and the transition function of the arena, over
+* random walks on the arena of a best-effort synthesis problem
+*/
+
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "CoOperativeReachabilitySynthesizer.h"
+#include "ExplicitStateDfa.h"
+#include "ExplicitStateDfaMona.h"
+#include "InputOutputPartition.h"
+#include "MonolithicBestEffortSynthesizer.h"
+#include "ReachabilitySynthesizer.h"
+#include "StrategyExecutor.h"
+#include "SymbolicStateDfa.h"
+#include "VarMgr.h"
+
+namespace {
+
+const std::size_t walk_count = 20;
+const std::size_t walk_length = 50;
+
+std::string read_specification(const std::string& filename) {
+  std::string specification;
+  std::ifstream specification_stream(filename);
+  std::getline(specification_stream, specification);
+  return specification;
+}
+
+// Solves the best-effort synthesis problem as the direct synthesizer does,
+// and compares the executor with the transducers on random walks, returning
+// the number of steps where they differ
+int check(const std::string& agent_specification,
+          const std::string& environment_specification,
+          const Syft::InputOutputPartition& partition,
+          Syft::Player starting_player) {
+  std::shared_ptr<Syft::VarMgr> var_mgr = std::make_shared<Syft::VarMgr>();
+  Syft::SynthesisOptions options;
+
+  std::vector<Syft::ExplicitStateDfaMona> formula_dfas =
+    Syft::ExplicitStateDfaMona::dfas_of_formulas(
+        Syft::MonolithicBestEffortSynthesizer::formulas(agent_specification,
+                                                        environment_specification,
+                                                        options), 1);
+  var_mgr->create_named_variables(formula_dfas[0].names);
+  var_mgr->partition_variables(partition.input_variables,
+                               partition.output_variables);
+
+  std::vector<Syft::SymbolicStateDfa> symbolic_dfas;
+  for (std::size_t i = 0; i < 3; ++i) {
+    Syft::ExplicitStateDfaMona non_empty_dfa =
+      Syft::ExplicitStateDfaMona::dfa_product({formula_dfas[i], formula_dfas[3]});
+    symbolic_dfas.push_back(Syft::SymbolicStateDfa::from_explicit(
+        Syft::ExplicitStateDfa::from_dfa_mona(var_mgr, non_empty_dfa)));
+  }
+  Syft::SymbolicStateDfa arena = Syft::SymbolicStateDfa::product(symbolic_dfas);
+
+  CUDD::BDD all_states = var_mgr->cudd_mgr()->bddOne();
+  Syft::BestEffortSynthesisResult result;
+  result.adversarial = Syft::ReachabilitySynthesizer(
+      arena, starting_player, Syft::Player::Agent,
+      symbolic_dfas[0].final_states(), all_states, options).run();
+  CUDD::BDD non_environment_winning_states = Syft::ReachabilitySynthesizer(
+      arena, starting_player, Syft::Player::Agent,
+      symbolic_dfas[1].final_states(), all_states, options).run().winning_states;
+  result.cooperative = Syft::CoOperativeReachabilitySynthesizer(
+      arena, starting_player, Syft::Player::Agent,
+      symbolic_dfas[2].final_states(), !non_environment_winning_states,
+      options).run();
+
+  // The strategy the executor compiles, evaluated with CUDD::BDD::Eval
+  CUDD::BDD winning_states = result.adversarial.winning_states;
+  CUDD::BDD cooperative_only_states =
+    (!winning_states) & result.cooperative.winning_states;
+  std::unordered_map<int, CUDD::BDD> adversarial_output_function =
+    result.adversarial.transducer->get_output_function();
+  std::unordered_map<int, CUDD::BDD> cooperative_output_function =
+    result.cooperative.transducer->get_output_function();
+  std::vector<CUDD::BDD> transition_function = arena.transition_function();
+
+  std::vector<int> input_indices;
+  for (const std::string& label : var_mgr->input_variable_labels()) {
+    input_indices.push_back(var_mgr->name_to_variable(label).NodeReadIndex());
+  }
+  std::vector<int> output_indices;
+  for (const std::string& label : var_mgr->output_variable_labels()) {
+    output_indices.push_back(var_mgr->name_to_variable(label).NodeReadIndex());
+  }
+  std::vector<int> state_indices;
+  for (const CUDD::BDD& variable : var_mgr->state_variables(arena.automaton_id())) {
+    state_indices.push_back(variable.NodeReadIndex());
+  }
+
+  std::mt19937 random(1);
+  int failures = 0;
+
+  // Both the explicit table and the symbolic execution are checked
+  for (std::size_t max_table_size : {std::size_t(1) << 20, std::size_t(0)}) {
+    Syft::StrategyExecutor executor(arena, result, max_table_size);
+
+    for (std::size_t walk = 0; walk < walk_count; ++walk) {
+      executor.reset();
+      std::vector<int> assignment = var_mgr->make_eval_vector(
+          arena.automaton_id(), arena.initial_state());
+
+      for (std::size_t step = 0; step < walk_length; ++step) {
+        std::vector<int> inputs(input_indices.size());
+        for (std::size_t i = 0; i < inputs.size(); ++i) {
+          inputs[i] = random() & 1;
+          assignment[input_indices[i]] = inputs[i];
+        }
+
+        const std::unordered_map<int, CUDD::BDD>* output_function;
+        Syft::StrategyExecutor::Region region;
+        if (winning_states.Eval(assignment.data()).IsOne()) {
+          output_function = &adversarial_output_function;
+          region = Syft::StrategyExecutor::Region::Winning;
+        } else if (cooperative_only_states.Eval(assignment.data()).IsOne()) {
+          output_function = &cooperative_output_function;
+          region = Syft::StrategyExecutor::Region::Cooperative;
+        } else {
+          output_function = nullptr;
+          region = Syft::StrategyExecutor::Region::Losing;
+        }
+
+        if (executor.region() != region) {
+          std::cerr << "Region differs in step " << step << std::endl;
+          ++failures;
+          break;
+        }
+
+        std::vector<int> outputs(output_indices.size());
+        bool moved = executor.step(inputs, outputs);
+        if (moved != (output_function != nullptr)) {
+          std::cerr << "Move differs in step " << step << std::endl;
+          ++failures;
+          break;
+        }
+        if (!moved) break;
+
+        for (std::size_t i = 0; i < output_indices.size(); ++i) {
+          int output = output_function->at(output_indices[i])
+            .Eval(assignment.data()).IsOne();
+          if (outputs[i] != output) {
+            std::cerr << "Output differs in step " << step << std::endl;
+            ++failures;
+          }
+          assignment[output_indices[i]] = output;
+        }
+
+        // The successor is computed in full before the state changes
+        std::vector<int> successor(state_indices.size());
+        for (std::size_t i = 0; i < state_indices.size(); ++i) {
+          successor[i] = transition_function[i].Eval(assignment.data()).IsOne();
+        }
+        for (std::size_t i = 0; i < state_indices.size(); ++i) {
+          assignment[state_indices[i]] = successor[i];
+        }
+      }
+    }
+  }
+
+  return failures;
+}
+
+}
+
+int main(int argc, char** argv) {
+  if (argc != 4) {
+    std::cerr << "Usage: " << argv[0]
+              << " <agent specification> <environment specification> <partition>"
+              << std::endl;
+    return 2;
+  }
+
+  std::string agent_specification = read_specification(argv[1]);
+  std::string environment_specification = read_specification(argv[2]);
+  Syft::InputOutputPartition partition =
+    Syft::InputOutputPartition::read_from_file(argv[3]);
+
+  int failures = 0;
+  for (Syft::Player starting_player :
+         {Syft::Player::Agent, Syft::Player::Environment}) {
+    failures += check(agent_specification, environment_specification,
+                      partition, starting_player);
+  }
+
+  std::cout << (failures == 0 ? "Moves match" : "Moves differ") << std::endl;
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,121 @@
+/*
+* Checks the images computed by PartitionedTransitionRelation against images
+* computed by composition with the transition function, on the arena of a
+* specification and of F(true)
+*/
+
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "ExplicitStateDfa.h"
+#include "ExplicitStateDfaMona.h"
+#include "InputOutputPartition.h"
+#include "PartitionedTransitionRelation.h"
+#include "SymbolicStateDfa.h"
+#include "VarMgr.h"
+
+namespace {
+
+// The successors of states, as the states whose composition with the
+// transition function intersects them
+CUDD::BDD composed_image(const Syft::SymbolicStateDfa& arena,
+                         const std::vector<CUDD::BDD>& transition_vector,
+                         const CUDD::BDD& states) {
+  std::shared_ptr<Syft::VarMgr> var_mgr = arena.var_mgr();
+  std::vector<CUDD::BDD> state_variables =
+    var_mgr->state_variables(arena.automaton_id());
+  CUDD::BDD image = var_mgr->cudd_mgr()->bddZero();
+
+  for (std::size_t state = 0; state < (std::size_t(1) << state_variables.size());
+       ++state) {
+    CUDD::BDD state_bdd = var_mgr->cudd_mgr()->bddOne();
+
+    for (std::size_t i = 0; i < state_variables.size(); ++i) {
+      state_bdd &= ((state >> i) & 1) ? state_variables[i] : !state_variables[i];
+    }
+
+    if (!(states & state_bdd.VectorCompose(transition_vector)).IsZero()) {
+      image |= state_bdd;
+    }
+  }
+
+  return image;
+}
+
+}
+
+int main(int argc, char** argv) {
+  if (argc != 3) {
+    std::cerr << "Usage: " << argv[0] << " <specification> <partition>" << std::endl;
+    return 2;
+  }
+
+  std::ifstream specification_file(argv[1]);
+  std::stringstream specification;
+  specification << specification_file.rdbuf();
+
+  std::shared_ptr<Syft::VarMgr> var_mgr = std::make_shared<Syft::VarMgr>();
+  Syft::InputOutputPartition partition =
+    Syft::InputOutputPartition::read_from_file(argv[2]);
+
+  // F(true) is kept as a DFA of its own, whose transitions do not depend on
+  // its state
+  std::vector<Syft::ExplicitStateDfaMona> formula_dfas =
+    Syft::ExplicitStateDfaMona::dfas_of_formulas({specification.str(), "F(true)"}, 1);
+  var_mgr->create_named_variables(formula_dfas[0].names);
+  var_mgr->partition_variables(partition.input_variables,
+                               partition.output_variables);
+
+  std::vector<Syft::SymbolicStateDfa> symbolic_dfas;
+  for (const Syft::ExplicitStateDfaMona& formula_dfa : formula_dfas) {
+    symbolic_dfas.push_back(Syft::SymbolicStateDfa::from_explicit(
+        Syft::ExplicitStateDfa::from_dfa_mona(var_mgr, formula_dfa)));
+  }
+  Syft::SymbolicStateDfa arena = Syft::SymbolicStateDfa::product(symbolic_dfas);
+
+  // Built first, since it creates the next-state variables that the compose
+  // vector needs to account for
+  CUDD::BDD existential_cube = var_mgr->input_cube() * var_mgr->output_cube();
+  std::vector<Syft::PartitionedTransitionRelation> relations;
+  for (std::size_t cluster_size : {std::size_t(0), std::size_t(2500)}) {
+    relations.push_back(Syft::PartitionedTransitionRelation::forward(
+        arena, arena.transition_function(), cluster_size, existential_cube));
+  }
+
+  std::vector<CUDD::BDD> transition_vector = var_mgr->make_compose_vector(
+      arena.automaton_id(), arena.transition_function());
+
+  // Compares the images of the sets of states reached in each step from the
+  // initial state, and of the states new in each step
+  CUDD::BDD reached = arena.initial_state_bdd();
+  std::vector<CUDD::BDD> checked = {reached};
+  int failures = 0;
+
+  while (!checked.empty()) {
+    CUDD::BDD states = checked.back();
+    checked.pop_back();
+    CUDD::BDD expected = composed_image(arena, transition_vector, states);
+
+    for (const Syft::PartitionedTransitionRelation& relation : relations) {
+      if (relation.image(states) != expected) {
+        std::cerr << "Image differs with " << relation.cluster_count()
+                  << " clusters" << std::endl;
+        ++failures;
+      }
+    }
+
+    CUDD::BDD new_states = expected * !reached;
+    if (!new_states.IsZero()) {
+      reached |= new_states;
+      checked.push_back(reached);
+      checked.push_back(new_states);
+    }
+  }
+
+  std::cout << (failures == 0 ? "Images match" : "Images differ") << std::endl;
+  return failures == 0 ? 0 : 1;
+}
@@ -1,11 +1,30 @@
+#include<sys/resource.h>
 #include<sys/stat.h>
+#include<sys/wait.h>
+#include<fcntl.h>
+#include<unistd.h>
+#include<algorithm>
+#include<chrono>
+#include<deque>
+#include<csignal>
 #include<cstring>
+#include<filesystem>
 #include<iostream>
 #include<istream>
 #include<memory>
+#include<sstream>
+#include<unordered_map>
+#include<unordered_set>
 #include<CLI/CLI.hpp>
 #include"Stopwatch.h"
 #include"ExplicitStateDfaMona.h"
+#include"CuddStatistics.h"
+#include"DfaCache.h"
+#include"DfaPrefetcher.h"
+#include"Reordering.h"
+#include"Serialization.h"
+#include"SynthesisReport.h"
+#include"Tracer.h"
 #include"SymbolicCompositionalBestEffortSynthesizer.h"
 #include"MonolithicBestEffortSynthesizer.h"
 #include"ExplicitCompositionalBestEffortSynthesizer.h"
@@ -28,251 +47,829 @@ double sumVec(const std::vector<double>& v)
     return sum;
 }
 
-int main(int argc, char** argv) {
+/**
+ * @brief Save a synthesized strategy to a file in binary form
+ * 
+ * @param[in] result - the synthesis result whose strategy is saved
+ * @param[in] filename - the file the strategy is saved to
+ */
+void saveStrategy(const Syft::SynthesisResult& result, const std::string& filename)
+{
+    result.transducer->save(filename);
+    std::cout << "[BeSyft] Strategy saved to " << filename << std::endl;
+}
 
-    CLI::App app {
-        "BeSyft: a tool for Reactive and Best-Effort Synthesis with LTLf Goals and Assumptions"
-    };
+/**
+ * @brief Saves the variable ordering of a manager, to be reused in later runs
+ * 
+ * @param[in] var_mgr - the manager whose variable ordering is saved
+ * @param[in] filename - the file the variable ordering is saved to
+ */
+void saveVariableOrder(const Syft::VarMgr& var_mgr, const std::string& filename)
+{
+    Syft::FilePointer file = Syft::open_file(filename, "w");
+    var_mgr.save_variable_order(file.get());
+    std::cout << "[BeSyft] Variable order saved to " << filename << std::endl;
+}
 
-    string agent_file, environment_file, partition_filename, outfile="";
-    int starting_flag, alg_id;
+/**
+ * @brief A synthesis problem to be solved
+ */
+struct Job
+{
+    std::string agent_file;
+    std::string environment_file;
+    std::string partition_file;
+    Syft::Player starting_player;
+    int algorithm;
+    bool dominance_check;
+};
 
+/**
+ * @brief What is done with the strategies synthesized for a job
+ */
+struct JobOutput
+{
     bool print_dot = false;
-    app.add_flag("-d,--print-dot", print_dot, "Print the output function(s)");
-
-    bool dominance_check = false;
-    app.add_flag("-c,--dominance-check", dominance_check, "Performs the dominance check");
-
     bool interactive = false;
-    app.add_flag("-i,--interactive", interactive, "Executes the synthesized strategy in interactive mode");
-   
-    CLI::Option* agent_formula_opt = 
-        app.add_option("-a,--agent-file", agent_file, "File to agent specification")->
-            required() -> check(CLI::ExistingFile);
+    std::string strategy_file;
+};
 
-    CLI::Option* environment_formula_file =
-        app.add_option("-e,--environment-file", environment_file, "File to environment assumption")->
-            required() -> check(CLI::ExistingFile);
+/**
+ * @brief Records which problem a job solves
+ * 
+ * @param[in] job - the job
+ * @param[out] report - the results of the job
+ */
+void describeJob(const Job& job, Syft::SynthesisReport& report)
+{
+    report.algorithm_id = job.algorithm;
+    report.algorithm = Syft::SynthesisReport::algorithm_name(job.algorithm);
+    report.agent_file = job.agent_file;
+    report.environment_file = job.environment_file;
+    report.partition_file = job.partition_file;
+    report.starting_player = job.starting_player;
+    report.dominance_check = job.dominance_check;
+}
 
-    CLI::Option* partition_file =
-        app.add_option("-p,--partition-file", partition_filename, "File to partition" )->
-            required () -> check(CLI::ExistingFile);
-    
-    CLI::Option* starting_opt =
-        app.add_option("-s,--starting-player", starting_flag, "Starting player:\nagent=1;\nenvironment=0.")->
-            required();
-    
-    CLI::Option* alg_id_opt =
-        app.add_option("-t,--algorithm", alg_id, "Specifies algorithm to use:\nDirect Best-Effort Synthesis=1;\nCompositional-Minimal Best-Effort Synthesis=2;\nCompositional Best-Effort Synthesis=3;\nCompositional-Minimal Reactive Synthesis=4\nCompositional Reactive Synthesis=5") -> required();
+/**
+ * @brief Reads an LTLf specification, given on the first line of a file
+ * 
+ * @param[in] filename - the file storing the specification
+ * @return the specification
+ */
+std::string readSpecification(const std::string& filename)
+{
+    string specification;
+    ifstream specification_stream(filename);
+    getline(specification_stream, specification);
+    return specification;
+}
 
-    CLI::Option* outfile_opt =
-        app.add_option("-f,--save-results", outfile, "If specified, save results in the passed file. Stores:\nAlgorithm;\nGoal file;\nEnvironment file;\nStarting player;\nLTLf2DFA (s);\nDFA2Sym (s);\nAdv Game (s);\nCoop Game (s); \t#best-effort synthesis algorithms only\nDominance Test (s); \t# best-effort synthesis algorithms only with -c option\nRun time(s);\nRealizability;\nDominance;\t#best-effort synthesis algorithms only with -c option");
+/**
+ * @brief Solves a synthesis problem, recording its results
+ * 
+ * @param[in] job - the problem to solve
+ * @param[in] v_mgr - a fresh manager for the variables of the problem
+ * @param[in] options - the options tuning how the problem is solved
+ * @param[in] output - what is done with the synthesized strategies
+ * @param[out] report - the results of the job, filled in as far as the job gets
+ */
+void runJob(const Job& job, std::shared_ptr<Syft::VarMgr> v_mgr, Syft::SynthesisOptions options, const JobOutput& output, Syft::SynthesisReport& report)
+{
+    describeJob(job, report);
+    options.telemetry_job = report.job_key();
+    bool reordering = Syft::reordering_enabled(options);
 
-    CLI11_PARSE(app, argc, argv);
+    if (report.algorithm == "") {
+        throw std::runtime_error("Error: Non-existing algorithm " + std::to_string(job.algorithm) + ".");
+    }
+    if (job.dominance_check && options.realizability_only) {
+        throw std::runtime_error("Error: The dominance check needs strategies, which are not synthesized with --realizability-only.");
+    }
 
-    string agent_specification;
-    ifstream agent_spec_stream(agent_file);
-    getline(agent_spec_stream, agent_specification);
+    string agent_specification = readSpecification(job.agent_file);
     cout << "[BeSyft] Agent specification: " << agent_specification << endl;
 
-    string environment_assumption;
-    ifstream env_assumption_stream(environment_file);
-    getline(env_assumption_stream, environment_assumption);
+    string environment_assumption = readSpecification(job.environment_file);
     cout << "[BeSyft] Environment assumption: " << environment_assumption << endl;
 
     Syft::InputOutputPartition partition =
-        Syft::InputOutputPartition::read_from_file(partition_filename);
-
-    Syft::Player starting_player;
-    if (starting_flag == 1) {
-        starting_player = Syft::Player::Agent;
-    } else {
-        starting_player = Syft::Player::Environment;
-    }
-
-    std::shared_ptr<Syft::VarMgr> v_mgr = std::make_shared<Syft::VarMgr>();
+        Syft::InputOutputPartition::read_from_file(job.partition_file);
 
     cout << "[BeSyft] Ready to start best-effort synthesis" << endl;
 
-    if (alg_id == 1) {
-        Syft::MonolithicBestEffortSynthesizer best_effort_synthesizer(v_mgr, agent_specification, environment_assumption, partition, starting_player, dominance_check);
+    if (job.algorithm == 1) {
+        Syft::MonolithicBestEffortSynthesizer best_effort_synthesizer(v_mgr, agent_specification, environment_assumption, partition, job.starting_player, job.dominance_check, options);
         auto result = best_effort_synthesizer.run();
         auto run_times = best_effort_synthesizer.get_running_times();
+        report.set_result(result, job.dominance_check);
+        report.set_phase_times(run_times, reordering);
+        report.problem_size = best_effort_synthesizer.get_problem_size();
+        if (output.strategy_file != "") {saveStrategy(result.adversarial, output.strategy_file + ".adv"); saveStrategy(result.cooperative, output.strategy_file + ".coop");}
         std::cout << "[BeSyft] Running time: " << sumVec(run_times) << " s" << std::endl;
         if (result.adversarial.realizability) {
             std::cout << "[BeSyft] Adversarially realizable. Computed winning strategy" << std::endl;
-            if (print_dot) {std::cout << "[BeSyft] Printing output function" << std::endl; result.adversarial.transducer.get() -> dump_dot("adv_outfunct.dot");}
-            if (outfile != "") {
-                    std::ofstream outstream(outfile, std::ifstream::app);
-                    outstream << "Direct Best-Effort Synthesizer," << agent_file << "," << environment_file << ",";
-                    if (starting_flag) outstream << "Agent,"; else outstream << "Environment,";
-                    if (dominance_check) outstream << run_times[0] << "," << run_times[1] << "," << run_times[2] << "," << run_times[3] << "," << run_times[4] << "," << sumVec(run_times) << ",Adv," << "Dom" << std::endl;                       
-                    else outstream << run_times[0] << "," << run_times[1] << "," << run_times[2] << "," << run_times[3] << ",NA," << sumVec(run_times) << ",Adv,Dom" << std::endl;
-                    
-                }
-            }
+            if (output.print_dot) {std::cout << "[BeSyft] Printing output function" << std::endl; result.adversarial.transducer.get() -> dump_dot("adv_outfunct.dot");}
+        }
         else if (result.cooperative.realizability) {
             std::cout << "[BeSyft] Cooperatively realizable. Computed best-effort strategy" << std::endl;
-            if (print_dot) {std::cout << "[BeSyft] Printing output functions" << std::endl; result.adversarial.transducer.get() -> dump_dot("adv_outfunct.dot"); result.cooperative.transducer.get() -> dump_dot("coop_outfunct");}
-            if (outfile != "") {
-                    std::ofstream outstream(outfile, std::ifstream::app);
-                    outstream << "Direct Best-Effort Synthesizer," << agent_file << "," << environment_file << ",";
-                    if (starting_flag) outstream << "Agent,"; else outstream << "Environment,";
-                    if (dominance_check) {
-                        outstream << run_times[0] << "," << run_times[1] << "," << run_times[2] << "," << run_times[3] << "," << run_times[4] << "," << sumVec(run_times) << ",Coop,";
-                        if (result.dominant) outstream << "Dom" << std::endl;
-                        else outstream << "NoDom" << std::endl; 
-                        }                       
-                    else outstream << run_times[0] << "," << run_times[1] << "," << run_times[2] << "," << run_times[3] << ",NA," << sumVec(run_times) << ",Coop,NA" << std::endl;
-                }
-            } 
-        else if (!result.adversarial.realizability && !result.cooperative.realizability) { 
+            if (output.print_dot) {std::cout << "[BeSyft] Printing output functions" << std::endl; result.adversarial.transducer.get() -> dump_dot("adv_outfunct.dot"); result.cooperative.transducer.get() -> dump_dot("coop_outfunct");}
+        }
+        else {
             std::cout << "[BeSyft] Unrealizable. Computed best-effort strategy" << std::endl;
-            if (outfile != "") {
-                    std::ofstream outstream(outfile, std::ifstream::app);
-                    outstream << "Direct Best-Effort Synthesizer," << agent_file << "," << environment_file << ",";
-                    if (starting_flag) outstream << "Agent,"; else outstream << "Environment,";
-                    if (dominance_check) outstream << run_times[0] << "," << run_times[1] << "," << run_times[2] << "," << run_times[3] << "," << run_times[4] << "," << sumVec(run_times) << ",Unr," << "Dom" << std::endl;                       
-                    else outstream << run_times[0] << "," << run_times[1] << "," << run_times[2] << "," << run_times[3] << ",NA," << sumVec(run_times) << ",Unr,Dom" << std::endl;
-            }
         }
-        if (interactive) best_effort_synthesizer.interactive(result);
+        if (output.interactive) best_effort_synthesizer.interactive(result);
     } 
-    else if (alg_id == 2) {
-        Syft::ExplicitCompositionalBestEffortSynthesizer best_effort_synthesizer(v_mgr, agent_specification, environment_assumption, partition, starting_player, dominance_check);
+    else if (job.algorithm == 2) {
+        Syft::ExplicitCompositionalBestEffortSynthesizer best_effort_synthesizer(v_mgr, agent_specification, environment_assumption, partition, job.starting_player, job.dominance_check, options);
         auto result = best_effort_synthesizer.run();
         auto run_times = best_effort_synthesizer.get_running_times();
+        report.set_result(result, job.dominance_check);
+        report.set_phase_times(run_times, reordering);
+        report.problem_size = best_effort_synthesizer.get_problem_size();
+        if (output.strategy_file != "") {saveStrategy(result.adversarial, output.strategy_file + ".adv"); saveStrategy(result.cooperative, output.strategy_file + ".coop");}
         std::cout << "[BeSyft] Running time: " << sumVec(run_times) << " s" << std::endl;
         if (result.adversarial.realizability) {
             std::cout << "[BeSyft] Adversarially realizable. Computed winning strategy" << std::endl;
-            if (print_dot) {std::cout << "[BeSyft] Printing output function" << std::endl; result.adversarial.transducer.get() -> dump_dot("adv_outfunct.dot");}
-            if (outfile != "") {
-                    std::ofstream outstream(outfile, std::ifstream::app);
-                    outstream << "Compositional-Minimal Best-Effort Synthesizer," << agent_file << "," << environment_file << ",";
-                    if (starting_flag) outstream << "Agent,"; else outstream << "Environment,";
-                    if (dominance_check) outstream << run_times[0] << "," << run_times[1] << "," << run_times[2] << "," << run_times[3] << "," << run_times[4] << "," << sumVec(run_times) << ",Adv," << "Dom" << std::endl;                       
-                    else outstream << run_times[0] << "," << run_times[1] << "," << run_times[2] << "," << run_times[3] << ",NA," << sumVec(run_times) << ",Adv,Dom" << std::endl;
-                }
+            if (output.print_dot) {std::cout << "[BeSyft] Printing output function" << std::endl; result.adversarial.transducer.get() -> dump_dot("adv_outfunct.dot");}
         } else if (result.cooperative.realizability) {
             std::cout << "[BeSyft] Cooperatively realizable. Computed best-effort strategy" << std::endl;
-            if (print_dot) {std::cout << "[BeSyft] Printing output functions" << std::endl; result.adversarial.transducer.get() -> dump_dot("adv_outfunct.dot"); result.cooperative.transducer.get() -> dump_dot("coop_outfunct");}
-            if (outfile != "") {
-                    std::ofstream outstream(outfile, std::ifstream::app);
-                    outstream << "Compositional-Minimal Best-Effort Synthesizer," << agent_file << "," << environment_file << ",";
-                    if (starting_flag) outstream << "Agent,"; else outstream << "Environment,";
-                    if (dominance_check) {
-                        outstream << run_times[0] << "," << run_times[1] << "," << run_times[2] << "," << run_times[3] << "," << run_times[4] << "," << sumVec(run_times) << ",Coop,";
-                        if (result.dominant) outstream << "Dom" << std::endl;
-                        else outstream << "NoDom" << std::endl; 
-                        }                       
-                    else outstream << run_times[0] << "," << run_times[1] << "," << run_times[2] << "," << run_times[3] << ",NA," << sumVec(run_times) << ",Coop,NA" << std::endl;
-                }
-            }
-        else if (!result.adversarial.realizability && !result.cooperative.realizability) { 
+            if (output.print_dot) {std::cout << "[BeSyft] Printing output functions" << std::endl; result.adversarial.transducer.get() -> dump_dot("adv_outfunct.dot"); result.cooperative.transducer.get() -> dump_dot("coop_outfunct");}
+        } else {
             std::cout << "[BeSyft] Unrealizable." << std::endl;
-            if (outfile != "") {
-                    std::ofstream outstream(outfile, std::ifstream::app);
-                    outstream << "Compositional-Minimal Best-Effort Synthesizer," << agent_file << "," << environment_file << ",";
-                    if (starting_flag) outstream << "Agent,"; else outstream << "Environment,";
-                    if (dominance_check) outstream << run_times[0] << "," << run_times[1] << "," << run_times[2] << "," << run_times[3] << "," << run_times[4] << "," << sumVec(run_times) << ",Unr," << "Dom" << std::endl;                       
-                    else outstream << run_times[0] << "," << run_times[1] << "," << run_times[2] << "," << run_times[3] << ",NA," << sumVec(run_times) << ",Unr,Dom" << std::endl;
-                }
-            }
-        if (interactive) best_effort_synthesizer.interactive(result);    
-        } 
-    else if (alg_id == 3) {
-        Syft::SymbolicCompositionalBestEffortSynthesizer best_effort_synthesizer(v_mgr, agent_specification, environment_assumption, partition, starting_player, dominance_check);
+        }
+        if (output.interactive) best_effort_synthesizer.interactive(result);    
+    } 
+    else if (job.algorithm == 3) {
+        Syft::SymbolicCompositionalBestEffortSynthesizer best_effort_synthesizer(v_mgr, agent_specification, environment_assumption, partition, job.starting_player, job.dominance_check, options);
         auto result = best_effort_synthesizer.run();
         auto run_times = best_effort_synthesizer.get_running_times();
+        report.set_result(result, job.dominance_check);
+        report.set_phase_times(run_times, reordering);
+        report.problem_size = best_effort_synthesizer.get_problem_size();
+        if (output.strategy_file != "") {saveStrategy(result.adversarial, output.strategy_file + ".adv"); saveStrategy(result.cooperative, output.strategy_file + ".coop");}
         std::cout << "[BeSyft] Running time: " << sumVec(run_times) << " s" << std::endl;
         if (result.adversarial.realizability) {
             std::cout << "[BeSyft] Adversarially realizable. Computed winning strategy" << std::endl;
-            if (print_dot) {std::cout << "[BeSyft] Printing output function" << std::endl; result.adversarial.transducer.get() -> dump_dot("adv_outfunct.dot");}
-            if (outfile != "") {
-                    std::ofstream outstream(outfile, std::ifstream::app);
-                    outstream << "Compositional Best-Effort Synthesizer," << agent_file << "," << environment_file << ",";
-                    if (starting_flag) outstream << "Agent,"; else outstream << "Environment,";
-                    if (dominance_check) outstream << run_times[0] << "," << run_times[1] << "," << run_times[2] << "," << run_times[3] << "," << run_times[4] << "," << sumVec(run_times) << ",Adv," << "Dom" << std::endl;                       
-                    else outstream << run_times[0] << "," << run_times[1] << "," << run_times[2] << "," << run_times[3] << ",NA," << sumVec(run_times) << ",Adv,Dom" << std::endl;
-                }
+            if (output.print_dot) {std::cout << "[BeSyft] Printing output function" << std::endl; result.adversarial.transducer.get() -> dump_dot("adv_outfunct.dot");}
         } else if (result.cooperative.realizability) {
             std::cout << "[BeSyft] Cooperatively realizable. Computed best-effort strategy" << std::endl;
-            if (print_dot) {std::cout << "[BeSyft] Printing output functions" << std::endl; result.adversarial.transducer.get() -> dump_dot("adv_outfunct.dot"); result.cooperative.transducer.get() -> dump_dot("coop_outfunct");}
-            if (outfile != "") {
-                    std::ofstream outstream(outfile, std::ifstream::app);
-                    outstream << "Compositional Best-Effort Synthesizer," << agent_file << "," << environment_file << ",";
-                    if (starting_flag) outstream << "Agent,"; else outstream << "Environment,";
-                    if (dominance_check) {
-                        outstream << run_times[0] << "," << run_times[1] << "," << run_times[2] << "," << run_times[3] << "," << run_times[4] << "," << sumVec(run_times) << ",Coop,";
-                        if (result.dominant) outstream << "Dom" << std::endl;
-                        else outstream << "NoDom" << std::endl; 
-                        }                       
-                    else outstream << run_times[0] << "," << run_times[1] << "," << run_times[2] << "," << run_times[3] << ",NA," << sumVec(run_times) << ",Coop,NA" << std::endl;
-                }
-            }
-        else if (!result.adversarial.realizability && !result.cooperative.realizability) { 
+            if (output.print_dot) {std::cout << "[BeSyft] Printing output functions" << std::endl; result.adversarial.transducer.get() -> dump_dot("adv_outfunct.dot"); result.cooperative.transducer.get() -> dump_dot("coop_outfunct");}
+        } else {
             std::cout << "[BeSyft] Unrealizable." << std::endl;
-            if (outfile != "") {
-                    std::ofstream outstream(outfile, std::ifstream::app);
-                    outstream << "Compositional Best-Effort Synthesizer," << agent_file << "," << environment_file << ",";
-                    if (starting_flag) outstream << "Agent,"; else outstream << "Environment,";
-                    if (dominance_check) outstream << run_times[0] << "," << run_times[1] << "," << run_times[2] << "," << run_times[3] << "," << run_times[4] << "," << sumVec(run_times) << ",Unr," << "Dom" << std::endl;                       
-                    else outstream << run_times[0] << "," << run_times[1] << "," << run_times[2] << "," << run_times[3] << ",NA," << sumVec(run_times) << ",Unr,Dom" << std::endl;
-                }
         }
-        if (interactive) best_effort_synthesizer.interactive(result);
+        if (output.interactive) best_effort_synthesizer.interactive(result);
     }
-    else if (alg_id == 4) {
-        Syft::AdversarialSynthesizer adv_synth(v_mgr, agent_specification, environment_assumption, partition, starting_player);
+    else if (job.algorithm == 4) {
+        Syft::AdversarialSynthesizer adv_synth(v_mgr, agent_specification, environment_assumption, partition, job.starting_player, options);
         auto result = adv_synth.run();
         auto run_times = adv_synth.get_running_times();
+        report.set_result(result);
+        report.set_phase_times(run_times, reordering);
+        report.problem_size = adv_synth.get_problem_size();
+        if (output.strategy_file != "" && result.realizability) saveStrategy(result, output.strategy_file + ".adv");
         std::cout << "[BeSyft] Running time: " << sumVec(run_times) << " s" << std::endl;
         if (result.realizability) {
             std::cout << "[BeSyft] Adversarially realizable. Computed winning strategy" << std::endl;
-            if (print_dot) {std::cout << "[BeSyft] Printing output function" << std::endl; result.transducer.get() -> dump_dot("adv_outfunct.dot");}
-            if (outfile != "") {
-                std::ofstream outstream(outfile, std::ifstream::app);
-                outstream << "Compositional-Minimal Reactive Synthesizer," << agent_file << "," << environment_file << ",";
-                if (starting_flag) outstream << "Agent,"; else outstream << "Environment,";
-                outstream << run_times[0] << "," << run_times[1] << "," << run_times[2] << ",NA,NA," << sumVec(run_times) << ",Adv,Dom" << std::endl;
-            }
+            if (output.print_dot) {std::cout << "[BeSyft] Printing output function" << std::endl; result.transducer.get() -> dump_dot("adv_outfunct.dot");}
         } else {
             std::cout << "[BeSyft] Not adversarially realizable." << std::endl;
-            if (outfile != "") {
-                std::ofstream outstream(outfile, std::ifstream::app);
-                outstream << "Compositional-Minimal Reactive Synthesizer," << agent_file << "," << environment_file << ",";
-                if (starting_flag) outstream << "Agent,"; else outstream << "Environment,";
-                outstream << run_times[0] << "," << run_times[1] << "," << run_times[2] << ",NA,NA,"  << sumVec(run_times) << ",NoAdv,NA" << std::endl;
-            }
         }        
-    } else if (alg_id == 5) {
-        Syft::SymbolicCompositionalAdversarialSynthesizer adv_synth(v_mgr, agent_specification, environment_assumption, partition, starting_player);
+    } else if (job.algorithm == 5) {
+        Syft::SymbolicCompositionalAdversarialSynthesizer adv_synth(v_mgr, agent_specification, environment_assumption, partition, job.starting_player, options);
         auto result = adv_synth.run();
         auto run_times = adv_synth.get_running_times();
+        report.set_result(result);
+        report.set_phase_times(run_times, reordering);
+        report.problem_size = adv_synth.get_problem_size();
+        if (output.strategy_file != "" && result.realizability) saveStrategy(result, output.strategy_file + ".adv");
         std::cout << "[BeSyft] Running time: " << sumVec(run_times) << " s" << std::endl;
         if (result.realizability) {
             std::cout << "[BeSyft] Adversarially realizable. Computed winning strategy" << std::endl;
-            if (print_dot) {std::cout << "[BeSyft] Printing output function" << std::endl; result.transducer.get() -> dump_dot("adv_outfunct.dot");}
-            if (outfile != "") {
-                std::ofstream outstream(outfile, std::ifstream::app);
-                outstream << "Compositional Reactive Synthesizer," << agent_file << "," << environment_file << ",";
-                if (starting_flag) outstream << "Agent,"; else outstream << "Environment,";
-                outstream << run_times[0] << "," << run_times[1] << "," << run_times[2] << ",NA,NA," << sumVec(run_times) << ",Adv,Dom" << std::endl;
-            }
+            if (output.print_dot) {std::cout << "[BeSyft] Printing output function" << std::endl; result.transducer.get() -> dump_dot("adv_outfunct.dot");}
         } else {
             std::cout << "[BeSyft] Not adversarially realizable." << std::endl;
-            if (outfile != "") {
-                std::ofstream outstream(outfile, std::ifstream::app);
-                outstream << "Compositional Reactive Synthesizer," << agent_file << "," << environment_file << ",";
-                if (starting_flag) outstream << "Agent,"; else outstream << "Environment,";
-                outstream << run_times[0] << "," << run_times[1] << "," << run_times[2] << ",NA,NA,"  << sumVec(run_times) << ",NoAdv,NA" << std::endl;
+        }
+    }
+}
+
+/**
+ * @brief Reads the jobs listed in a batch manifest
+ * 
+ * Each non-empty line not starting with # lists the agent file, the environment
+ * file, the partition file, the starting player (agent=1, environment=0) and
+ * the algorithm of a job, separated by whitespace, optionally followed by -c to
+ * perform the dominance check
+ * 
+ * @param[in] filename - the manifest
+ * @param[in] dominance_check - whether every job performs the dominance check
+ * @return the jobs, in the order they are listed
+ */
+std::vector<Job> readManifest(const std::string& filename, bool dominance_check)
+{
+    std::ifstream manifest(filename);
+    std::vector<Job> jobs;
+    std::string line;
+    std::size_t line_number = 0;
+
+    while (getline(manifest, line)) {
+        ++line_number;
+        std::istringstream fields(line);
+        Job job;
+        int starting_flag;
+        if (!(fields >> job.agent_file) || job.agent_file[0] == '#') continue;
+        if (!(fields >> job.environment_file >> job.partition_file >> starting_flag >> job.algorithm)) {
+            throw std::runtime_error("Error: Incomplete job on line " + std::to_string(line_number) + " of " + filename + ".");
+        }
+        job.starting_player = starting_flag == 1 ? Syft::Player::Agent : Syft::Player::Environment;
+        std::string flag;
+        job.dominance_check = dominance_check || (fields >> flag && flag == "-c");
+        jobs.push_back(job);
+    }
+
+    return jobs;
+}
+
+/**
+ * @brief Lists the formulas a job translates to DFAs
+ * 
+ * @param[in] job - the job
+ * @param[in] options - the options tuning how the job is solved
+ * @return the formulas, or none if the algorithm does not exist or the
+ * specifications cannot be parsed
+ */
+std::vector<std::string> jobFormulas(const Job& job, const Syft::SynthesisOptions& options)
+{
+    std::string agent_specification = readSpecification(job.agent_file);
+    std::string environment_assumption = readSpecification(job.environment_file);
+
+    try {
+        switch (job.algorithm) {
+            case 1: return Syft::MonolithicBestEffortSynthesizer::formulas(agent_specification, environment_assumption, options);
+            case 2: return Syft::ExplicitCompositionalBestEffortSynthesizer::formulas(agent_specification, environment_assumption, options);
+            case 3: return Syft::SymbolicCompositionalBestEffortSynthesizer::formulas(agent_specification, environment_assumption, options);
+            case 4: return Syft::AdversarialSynthesizer::formulas(agent_specification, environment_assumption, options);
+            case 5: return Syft::SymbolicCompositionalAdversarialSynthesizer::formulas(agent_specification, environment_assumption, options);
+            default: return {};
+        }
+    } catch (const std::exception&) {
+        // Specifications that cannot be split fail when the job runs
+        return {};
+    }
+}
+
+/**
+ * @brief Translates the formulas of a job ahead of it, to size the initial CUDD tables of the job from their DFAs
+ * 
+ * The DFAs are provided to the job, which finds them in memory. If the formulas cannot be translated, the resources are kept and the job fails when translating them itself
+ * 
+ * @param[in] job - the job
+ * @param[in] options - the options of the job
+ * @param[in,out] resources - the resources of the manager of the job
+ * @return the time spent translating, in seconds, which belongs to the LTLf-to-DFA phase of the job
+ */
+double fitResourcesToDfas(const Job& job, const Syft::SynthesisOptions& options, Syft::CuddResources& resources)
+{
+    Syft::Stopwatch translation;
+    translation.start();
+    try {
+        std::vector<std::string> formulas = jobFormulas(job, options);
+        std::vector<Syft::ExplicitStateDfaMona> dfas = Syft::ExplicitStateDfaMona::dfas_of_formulas(formulas, options.jobs, options.dfa_cache_directory);
+        resources = resources.fitted_to_dfas(Syft::ExplicitStateDfaMona::node_count(dfas));
+
+        std::unordered_map<std::string, Syft::ExplicitStateDfaMona> provided;
+        for (std::size_t i = 0; i < formulas.size(); ++i) provided.emplace(formulas[i], dfas[i]);
+        Syft::ExplicitStateDfaMona::provide_dfas(std::move(provided));
+        std::cout << "[BeSyft] CUDD tables sized from the DFAs: " << resources.unique_slots << " unique slots per variable, " << resources.cache_slots << " cache slots" << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "[BeSyft] Could not size the CUDD tables from the DFAs: " << e.what() << std::endl;
+    }
+    return translation.stop().count() / 1000.0;
+}
+
+/**
+ * @brief Tells why a job was stopped
+ * 
+ * @param[in] v_mgr - the manager of the job
+ * @return the status of the job
+ */
+Syft::RunStatus failureStatus(const Syft::VarMgr& v_mgr)
+{
+    switch (v_mgr.cudd_mgr()->ReadErrorCode()) {
+        case CUDD_TIMEOUT_EXPIRED: return Syft::RunStatus::TimedOut;
+        case CUDD_MAX_MEM_EXCEEDED:
+        case CUDD_MEMORY_OUT: return Syft::RunStatus::OutOfMemory;
+        default: return Syft::RunStatus::Failed;
+    }
+}
+
+/**
+ * @brief Prints the statistics of the CUDD manager of a job and records them in its results
+ * 
+ * JSON results hold the statistics. With CSV results, they are appended to <outfile>.cudd together with the key of the job
+ * 
+ * @param[in] v_mgr - the manager of the job
+ * @param[out] report - the results of the job
+ * @param[in] outfile - the results file, or an empty string
+ * @param[in] results_format - the format of the results file
+ */
+void recordCuddStatistics(const Syft::VarMgr& v_mgr, Syft::SynthesisReport& report, const std::string& outfile, Syft::ResultsFormat results_format)
+{
+    report.cudd_statistics = Syft::CuddStatistics::of(*v_mgr.cudd_mgr());
+    report.cudd_statistics->print(std::cout);
+    if (outfile != "" && results_format == Syft::ResultsFormat::Csv) report.append_cudd_statistics_to(outfile);
+}
+
+/**
+ * @brief How the jobs of a batch are run
+ */
+struct BatchSettings
+{
+    Syft::SynthesisOptions options;
+    Syft::CuddResources resources;
+    unsigned long timeout = 0;          // CPU time limit of a job in seconds, or 0
+    std::size_t max_memory = 0;         // memory limit of a job in MB, or 0
+    bool cudd_statistics = false;
+    std::string outfile;
+    Syft::ResultsFormat results_format = Syft::ResultsFormat::Csv;
+};
+
+/**
+ * @brief Runs a job in this process under the limits of CUDD, recording why it stopped if it did not complete
+ * 
+ * @param[in] job - the job
+ * @param[in] settings - how the job is run
+ * @return the results of the job
+ */
+Syft::SynthesisReport runLimitedJob(const Job& job, const BatchSettings& settings)
+{
+    Syft::CuddResources resources = settings.resources;
+    if (settings.max_memory > 0) resources.max_memory = settings.max_memory << 20;
+
+    Syft::Stopwatch job_time;
+    job_time.start();
+    double fit_time = settings.options.fit_cache_to_dfas ? fitResourcesToDfas(job, settings.options, resources) : 0.0;
+
+    std::shared_ptr<Syft::VarMgr> v_mgr = std::make_shared<Syft::VarMgr>(resources);
+    Syft::configure_reordering(*v_mgr->cudd_mgr(), settings.options);
+    if (settings.timeout > 0) {
+        // The time spent sizing the tables counts towards the limit
+        unsigned long fit_ms = static_cast<unsigned long>(fit_time * 1000);
+        v_mgr->cudd_mgr()->ResetStartTime();
+        v_mgr->cudd_mgr()->SetTimeLimit(std::max(settings.timeout * 1000, fit_ms + 1) - fit_ms);
+    }
+
+    Syft::SynthesisReport report;
+    try {
+        runJob(job, v_mgr, settings.options, JobOutput(), report);
+        if (fit_time > 0) report.add_phase_time("ltlf2dfa", fit_time);
+    } catch (const std::bad_alloc&) {
+        std::cerr << "[BeSyft] Job ran out of memory" << std::endl;
+        report.set_failure(Syft::RunStatus::OutOfMemory, job_time.stop().count() / 1000.0);
+    } catch (const std::exception& e) {
+        std::cerr << "[BeSyft] Job stopped: " << e.what() << std::endl;
+        report.set_failure(failureStatus(*v_mgr), job_time.stop().count() / 1000.0);
+    }
+
+    report.set_peak_memory(*v_mgr->cudd_mgr());
+    if (settings.cudd_statistics) recordCuddStatistics(*v_mgr, report, settings.outfile, settings.results_format);
+    return report;
+}
+
+/**
+ * @brief Prints that a job of a batch has finished
+ * 
+ * @param[in] finished - the number of jobs finished so far
+ * @param[in] total - the number of jobs to run
+ * @param[in] job - the job
+ * @param[in] status - whether the job completed
+ * @param[in] elapsed - the time the job took in seconds
+ */
+void printProgress(std::size_t finished, std::size_t total, const Job& job, Syft::RunStatus status, double elapsed)
+{
+    std::cout << "[BeSyft] [" << finished << "/" << total << "] " << job.agent_file << " " << job.environment_file << " -t " << job.algorithm << ": " << Syft::SynthesisReport::status_name(status) << " in " << elapsed << " s" << std::endl;
+}
+
+/**
+ * @brief Runs the jobs of a batch in forked worker processes, at most workers at a time
+ * 
+ * Each worker is bounded by a CPU time limit and an address-space limit, and
+ * saves the results of its job to a temporary file. Results are appended to
+ * the results file as soon as each job finishes, in the order jobs finish.
+ * Workers that exit without results are recorded as timed out if they used
+ * up their CPU time, as out of memory if their resident set came within 10%
+ * of the memory limit, and as failed otherwise
+ * 
+ * @param[in] jobs - the jobs to run
+ * @param[in] workers - the maximum number of workers running at the same time
+ * @param[in] settings - how the jobs are run
+ */
+void runInWorkers(const std::vector<Job>& jobs, std::size_t workers, const BatchSettings& settings)
+{
+    std::string dir_template =
+        (std::filesystem::temp_directory_path() / "besyft-batch-XXXXXX").string();
+    if (mkdtemp(dir_template.data()) == nullptr)
+        throw std::runtime_error("Error: could not create a directory for worker processes.");
+    std::filesystem::path dir(dir_template);
+
+    std::unordered_map<pid_t, std::pair<std::size_t, std::chrono::steady_clock::time_point>> running;
+    std::size_t next = 0;
+    std::size_t finished = 0;
+
+    while (next < jobs.size() || !running.empty()) {
+        if (next < jobs.size() && running.size() < workers) {
+            std::string report_file = (dir / (std::to_string(next) + ".result")).string();
+            std::cout.flush();
+            pid_t pid = fork();
+            if (pid < 0)
+                throw std::runtime_error("Error: could not start a worker process.");
+            if (pid == 0) {
+                // Workers only report through their results file
+                int null_output = open("/dev/null", O_WRONLY);
+                if (null_output >= 0) dup2(null_output, STDOUT_FILENO);
+                if (settings.timeout > 0) {
+                    rlimit cpu_limit{settings.timeout, settings.timeout + 1};
+                    setrlimit(RLIMIT_CPU, &cpu_limit);
+                }
+                if (settings.max_memory > 0) {
+                    rlim_t bytes = static_cast<rlim_t>(settings.max_memory) << 20;
+                    rlimit memory_limit{bytes, bytes};
+                    setrlimit(RLIMIT_AS, &memory_limit);
+                }
+                Syft::SynthesisReport report = runLimitedJob(jobs[next], settings);
+                report.append_to(report_file, settings.results_format);
+                _exit(static_cast<int>(report.status));
+            }
+            running[pid] = {next, std::chrono::steady_clock::now()};
+            ++next;
+            continue;
+        }
+
+        int status;
+        rusage usage;
+        pid_t pid = wait4(-1, &status, 0, &usage);
+        if (pid < 0)
+            throw std::runtime_error("Error: could not wait for a worker process.");
+        auto worker = running.find(pid);
+        if (worker == running.end()) continue;
+
+        std::size_t index = worker->second.first;
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - worker->second.second;
+        running.erase(worker);
+
+        std::string report_file = (dir / (std::to_string(index) + ".result")).string();
+        std::ifstream report_stream(report_file);
+        std::string line;
+        Syft::RunStatus run_status;
+
+        if (WIFEXITED(status) && getline(report_stream, line)) {
+            run_status = static_cast<Syft::RunStatus>(WEXITSTATUS(status));
+            std::ofstream outstream(settings.outfile, std::ifstream::app);
+            outstream << line << std::endl;
+            if (settings.results_format == Syft::ResultsFormat::Csv) {
+                Syft::SynthesisReport report;
+                describeJob(jobs[index], report);
+                report.append_key_to(settings.outfile);
             }
+        } else {
+            // Whatever signal stopped the worker, its resource usage tells
+            // which limit it reached. The resident set stays below the
+            // address-space limit, hence a worker close to it counts as out
+            // of memory.
+            double cpu_time = usage.ru_utime.tv_sec + usage.ru_stime.tv_sec +
+                (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e6;
+            bool timed_out = settings.timeout > 0 && cpu_time >= settings.timeout;
+            bool out_of_memory = settings.max_memory > 0 &&
+                usage.ru_maxrss >= 0.9 * (settings.max_memory << 10);
+            if (timed_out) run_status = Syft::RunStatus::TimedOut;
+            else if (out_of_memory) run_status = Syft::RunStatus::OutOfMemory;
+            else run_status = Syft::RunStatus::Failed;
+            Syft::SynthesisReport report;
+            describeJob(jobs[index], report);
+            report.set_failure(run_status, elapsed.count());
+            report.peak_rss_kb = usage.ru_maxrss;
+            report.append_to(settings.outfile, settings.results_format);
         }
+        std::filesystem::remove(report_file);
+
+        printProgress(++finished, jobs.size(), jobs[index], run_status, elapsed.count());
     }
-    else {
-        std::cerr << "[BeSyft] Non-existing algorithm. Terminating" << std::endl;
+
+    std::filesystem::remove_all(dir);
+}
+
+int main(int argc, char** argv) {
+
+    CLI::App app {
+        "BeSyft: a tool for Reactive and Best-Effort Synthesis with LTLf Goals and Assumptions"
+    };
+
+    string agent_file, environment_file, partition_filename, outfile="", strategy_file="";
+    int starting_flag, alg_id;
+
+    bool print_dot = false;
+    app.add_flag("-d,--print-dot", print_dot, "Print the output function(s)");
+
+    bool dominance_check = false;
+    app.add_flag("-c,--dominance-check", dominance_check, "Performs the dominance check");
+
+    bool interactive = false;
+    app.add_flag("-i,--interactive", interactive, "Executes the synthesized strategy in interactive mode");
+
+    Syft::SynthesisOptions options;
+
+    bool full_preimage = false;
+    app.add_flag("--full-preimage", full_preimage, "Recomputes the preimage of the whole winning region at each fixpoint iteration");
+
+    string preimage_engine = "compose";
+    app.add_option("--preimage-engine", preimage_engine, "Computes preimages in the games by:\ncompose=composition with the transition function (default);\nrelational=relational product with a partitioned transition relation.")->
+        check(CLI::IsMember({"compose", "relational"}));
+
+    string dominance_engine = "symbolic";
+    app.add_option("--dominance-engine", dominance_engine, "Explores the arena in the dominance check by:\nsymbolic=images of sets of states (default);\nexplicit=enumeration of states and environment moves, for arenas with at most 512 state bits and 62 inputs.")->
+        check(CLI::IsMember({"symbolic", "explicit"}));
+
+    string variable_order = "creation";
+    app.add_option("--variable-order", variable_order, "Orders the BDD variables once the arena is constructed by:\ncreation=creation order (default);\nstate-bits-on-top=state variables of each automaton in turn, above propositions;\ninterleaved=state variables of all automata interleaved bit by bit, above propositions;\nplayer-turn=state variables, then the propositions of the player moving first;\nformula-structure=co-occurring propositions together, each automaton above its first proposition.")->
+        check(CLI::IsMember({"creation", "state-bits-on-top", "interleaved", "player-turn", "formula-structure"}));
+
+    app.add_flag("--group-automata", options.group_automaton_variables, "Keeps the state variables of each automaton together in dynamic reordering");
+
+    string reordering_method = "sift";
+    app.add_option("--reorder-method", reordering_method, "Reorders the BDD variables with:\nsift=sifting (default);\nsymm-sift=symmetric sifting;\ngroup-sift=group sifting;\nwindow=window permutation;\nannealing=simulated annealing.")->
+        check(CLI::IsMember({"sift", "symm-sift", "group-sift", "window", "annealing"}));
+
+    app.add_flag("--dynamic-reordering", options.dynamic_reordering, "Reorders the BDD variables whenever the number of nodes reaches a threshold");
+
+    app.add_option("--reorder-threshold", options.reordering_threshold, "Number of BDD nodes at which the first dynamic reordering occurs (default: CUDD's)");
+
+    app.add_option("--max-growth", options.max_growth, "Maximum growth of a BDD while moving a variable during reordering, as a factor (default: CUDD's)");
+
+    app.add_flag("--reorder-after-arena", options.reorder_after_arena, "Reorders the BDD variables once the arena is constructed");
+
+    app.add_option("--reorder-every", options.reorder_interval, "Reorders the BDD variables every given number of fixpoint iterations in the games (default: 0, never)");
+
+    app.add_option("--load-variable-order", options.variable_order_file, "Installs the variable order saved by a previous run once the arena is constructed, instead of --variable-order")->
+        check(CLI::ExistingFile);
+
+    string variable_order_file = "";
+    app.add_option("--save-variable-order", variable_order_file, "If specified, save the final variable order in the passed file");
+
+    Syft::CuddResources cudd_resources;
+    app.add_option("--cudd-unique-slots", cudd_resources.unique_slots, "Initial number of slots in each subtable of the CUDD unique table (default: CUDD's, or sized from the DFAs with --fit-cache)");
+
+    app.add_option("--cudd-cache-slots", cudd_resources.cache_slots, "Initial number of slots in the CUDD cache (default: CUDD's, or sized from the DFAs with --fit-cache)");
+
+    size_t cudd_max_memory = 0;
+    app.add_option("--cudd-max-memory", cudd_max_memory, "Maximum memory in MB used by CUDD (default: 0, no limit)");
+
+    app.add_option("--cudd-max-cache", cudd_resources.max_cache_hard, "Maximum number of slots the CUDD cache may grow to (default: CUDD's)");
+
+    app.add_option("--cudd-loose-up-to", cudd_resources.loose_up_to, "Number of nodes up to which the CUDD unique table grows before garbage collecting (default: CUDD's)");
+
+    bool no_garbage_collection = false;
+    app.add_flag("--no-gc", no_garbage_collection, "Disables garbage collection of BDD nodes");
+
+    app.add_flag("--fit-cache", options.fit_cache_to_dfas, "Sizes the CUDD cache and unique table from the DFAs: the initial tables, smaller than CUDD's defaults for small DFAs, unless given with --cudd-unique-slots or --cudd-cache-slots, and the limits up to which they grow. The formulas are translated before the manager is constructed, and the time counts as LTLf-to-DFA time");
+
+    bool cudd_statistics = false;
+    app.add_flag("--cudd-stats", cudd_statistics, "Prints the statistics of the CUDD manager at the end of the run. With -f, also saves them in the JSON results, or in <file>.cudd as JSON lines keyed by job for CSV results");
+
+    app.add_option("--fixpoint-telemetry", options.telemetry_file, "If specified, append statistics on every fixpoint iteration of the games to the passed file, as JSON lines naming the game (adversarial, negated-environment or cooperative) and the job");
+
+    string trace_file = "";
+    app.add_option("--trace", trace_file, "If specified, save the wall time, CPU time and peak memory of every phase to the passed file, in Chrome's trace-event format");
+
+    app.add_option("--cluster-size", options.cluster_size, "Maximum number of BDD nodes in a cluster of the transition relation used by the relational engine (default: 5000)");
+
+    app.add_flag("--split-conjunctions", options.split_conjunctions, "Compositional algorithms construct one DFA per top-level conjunct of the agent specification and environment assumption");
+
+    app.add_flag("--concurrent-games", options.concurrent_games, "Best-effort synthesis algorithms solve the game against the negated environment assumption on a second BDD manager and thread, alongside the adversarial game. May double the memory used by the games");
+
+    app.add_flag("--realizability-only", options.realizability_only, "Only decides realizability, without synthesizing strategies. Cannot be combined with -c, -d, -i or --save-strategy");
+
+    bool no_strategy_verification = false;
+    app.add_flag("--no-strategy-verification", no_strategy_verification, "Skips checking that synthesized strategies implement every winning move");
+
+    bool dfa_cache = false;
+    app.add_flag("--dfa-cache", dfa_cache, "Loads the DFAs of formulas from an on-disk cache, storing them there after translation ($XDG_CACHE_HOME/besyft by default)");
+
+    app.add_option("--dfa-cache-dir", options.dfa_cache_directory, "Directory of the on-disk cache of DFAs. Implies --dfa-cache");
+
+    app.add_option("-j,--jobs", options.jobs, "Maximum number of worker processes translating formulas to DFAs or multiplying DFAs concurrently, and of threads in the explicit dominance check (default: 1)");
+   
+    CLI::Option* agent_formula_opt = 
+        app.add_option("-a,--agent-file", agent_file, "File to agent specification")->
+            check(CLI::ExistingFile);
+
+    CLI::Option* environment_formula_file =
+        app.add_option("-e,--environment-file", environment_file, "File to environment assumption")->
+            check(CLI::ExistingFile);
+
+    CLI::Option* partition_file =
+        app.add_option("-p,--partition-file", partition_filename, "File to partition" )->
+            check(CLI::ExistingFile);
+    
+    CLI::Option* starting_opt =
+        app.add_option("-s,--starting-player", starting_flag, "Starting player:\nagent=1;\nenvironment=0.");
+    
+    CLI::Option* alg_id_opt =
+        app.add_option("-t,--algorithm", alg_id, "Specifies algorithm to use:\nDirect Best-Effort Synthesis=1;\nCompositional-Minimal Best-Effort Synthesis=2;\nCompositional Best-Effort Synthesis=3;\nCompositional-Minimal Reactive Synthesis=4\nCompositional Reactive Synthesis=5");
+
+    CLI::Option* outfile_opt =
+        app.add_option("-f,--save-results", outfile, "If specified, save results in the passed file. Stores:\nAlgorithm;\nGoal file;\nEnvironment file;\nStarting player;\nLTLf2DFA (s);\nDFA2Sym (s);\nAdv Game (s);\nCoop Game (s); \t#best-effort synthesis algorithms only\nDominance Test (s); \t# best-effort synthesis algorithms only with -c option\nRun time(s);\nRealizability;\nDominance;\t#best-effort synthesis algorithms only with -c option\nThe key of each job, which adds the partition file and -c, is appended to <file>.jobs.\nGame times exclude strategy extraction, which runs when a strategy is first used, e.g. by the dominance test or --save-strategy, and are therefore lower than in EmpiricalResults.");
+
+    string results_format_name = "csv";
+    app.add_option("--results-format", results_format_name, "Format of the results saved with -f:\ncsv=the columns above, one row per run (default);\njson=one JSON object per run and per line, with named phase timings, DFA and arena sizes, BDD sizes, peak memory and, with --cudd-stats, the CUDD statistics.")->
+        check(CLI::IsMember({"csv", "json"}));
+
+    app.add_option("--save-strategy", strategy_file, "If specified, save the computed strategies in binary form. Best-effort synthesis algorithms store the adversarial strategy in <file>.adv and the cooperative one in <file>.coop; reactive synthesis algorithms store the winning strategy in <file>.adv if realizable");
+
+    CLI::App* batch = app.add_subcommand("batch", "Runs the jobs listed in a manifest, each with a fresh BDD manager, appending their results to the file given with -f. Options given before batch apply to every job. Each line of the manifest lists the agent file, environment file, partition file, starting player and algorithm of a job, optionally followed by -c");
+
+    string manifest_file;
+    batch->add_option("manifest", manifest_file, "File listing the jobs")->
+        required() -> check(CLI::ExistingFile);
+
+    unsigned long job_timeout = 0;
+    batch->add_option("--job-timeout", job_timeout, "CPU time limit in seconds on the BDD operations of each job, and with --workers on the whole worker process (default: 0, no limit)");
+
+    size_t job_max_memory = 0;
+    batch->add_option("--job-max-memory", job_max_memory, "Maximum memory in MB used by CUDD in each job, and with --workers by the whole worker process (default: --cudd-max-memory)");
+
+    size_t workers = 0;
+    batch->add_option("--workers", workers, "Runs the jobs in this many worker processes at the same time, each bounded in CPU time by --job-timeout and in address space by --job-max-memory (default: 0, jobs run in this process)");
+
+    size_t prefetch = 0;
+    batch->add_option("--prefetch", prefetch, "Without --workers, translates the formulas of up to this many upcoming jobs to DFAs in background processes while the current job is solved (default: 0, each job translates its own formulas)");
+
+    bool resume = false;
+    batch->add_flag("--resume", resume, "Skips the jobs whose results are already in the file given with -f");
+
+    CLI11_PARSE(app, argc, argv);
+
+    if (trace_file != "") Syft::Tracer::instance().enable();
+
+    options.frontier_preimage = !full_preimage;
+    options.verify_strategies = !no_strategy_verification;
+    if (options.realizability_only && (dominance_check || print_dot || interactive || strategy_file != "")) {
+        std::cerr << "[BeSyft] Options -c, -d, -i and --save-strategy need strategies, which are not synthesized with --realizability-only" << std::endl;
         return 1;
     }
+    Syft::ResultsFormat results_format = results_format_name == "json" ?
+        Syft::ResultsFormat::JsonLines : Syft::ResultsFormat::Csv;
+    if (preimage_engine == "relational") {
+        options.preimage_engine = Syft::PreimageEngine::Relational;
+    }
+    if (variable_order == "state-bits-on-top") {
+        options.variable_order = Syft::VariableOrder::StateBitsOnTop;
+    } else if (variable_order == "interleaved") {
+        options.variable_order = Syft::VariableOrder::Interleaved;
+    } else if (variable_order == "player-turn") {
+        options.variable_order = Syft::VariableOrder::PlayerTurn;
+    } else if (variable_order == "formula-structure") {
+        options.variable_order = Syft::VariableOrder::FormulaStructure;
+    }
+    if (reordering_method == "symm-sift") {
+        options.reordering_method = Syft::ReorderingMethod::SymmetricSift;
+    } else if (reordering_method == "group-sift") {
+        options.reordering_method = Syft::ReorderingMethod::GroupSift;
+    } else if (reordering_method == "window") {
+        options.reordering_method = Syft::ReorderingMethod::Window;
+    } else if (reordering_method == "annealing") {
+        options.reordering_method = Syft::ReorderingMethod::Annealing;
+    }
+    if (dominance_engine == "explicit") {
+        options.dominance_engine = Syft::DominanceEngine::Explicit;
+    }
+    if (dfa_cache && options.dfa_cache_directory.empty()) {
+        options.dfa_cache_directory = Syft::DfaCache::default_directory();
+        if (options.dfa_cache_directory.empty()) {
+            cout << "[BeSyft] Warning: neither XDG_CACHE_HOME nor HOME is set, DFA cache disabled" << endl;
+        }
+    }
+
+    cudd_resources.max_memory = cudd_max_memory << 20;
+    cudd_resources.garbage_collection = !no_garbage_collection;
+
+    if (*batch) {
+        if (outfile == "") {
+            std::cerr << "[BeSyft] A batch requires a results file, given with -f" << std::endl;
+            return 1;
+        }
+        if (*agent_formula_opt || *environment_formula_file || *partition_file || *starting_opt || *alg_id_opt) {
+            std::cerr << "[BeSyft] Options -a, -e, -p, -s and -t are given for each job in the manifest of a batch" << std::endl;
+            return 1;
+        }
+        if (print_dot || interactive || strategy_file != "" || variable_order_file != "") {
+            std::cerr << "[BeSyft] Options -d, -i, --save-strategy and --save-variable-order cannot be combined with batch" << std::endl;
+            return 1;
+        }
+
+        std::vector<Job> jobs = readManifest(manifest_file, dominance_check);
+
+        if (resume) {
+            std::unordered_set<std::string> saved_jobs = Syft::SynthesisReport::saved_job_keys(outfile);
+
+            std::vector<Job> pending_jobs;
+            for (const Job& job : jobs) {
+                Syft::SynthesisReport report;
+                describeJob(job, report);
+                if (saved_jobs.count(report.job_key()) == 0) pending_jobs.push_back(job);
+            }
+            cout << "[BeSyft] Skipping " << jobs.size() - pending_jobs.size() << " jobs with saved results" << endl;
+            jobs = std::move(pending_jobs);
+        }
+
+        // Formulas shared by several jobs, such as F(true), are translated
+        // once and kept in memory. DFAs of other formulas live as long as
+        // their job.
+        std::unordered_map<std::string, std::size_t> formula_jobs;
+        for (const Job& job : jobs) {
+            std::vector<std::string> formulas = jobFormulas(job, options);
+            for (const std::string& formula : std::unordered_set<std::string>(formulas.begin(), formulas.end())) {
+                ++formula_jobs[formula];
+            }
+        }
+        std::unordered_set<std::string> shared_formulas = {"F(true)"};
+        for (const auto& formula_and_jobs : formula_jobs) {
+            if (formula_and_jobs.second > 1) shared_formulas.insert(formula_and_jobs.first);
+        }
+        Syft::ExplicitStateDfaMona::set_memoized_formulas(shared_formulas);
+
+        BatchSettings settings;
+        settings.options = options;
+        settings.resources = cudd_resources;
+        settings.timeout = job_timeout;
+        settings.max_memory = job_max_memory;
+        settings.cudd_statistics = cudd_statistics;
+        settings.outfile = outfile;
+        settings.results_format = results_format;
+
+        if (workers > 0) {
+            runInWorkers(jobs, workers, settings);
+        } else {
+            // Prefetchers of the upcoming jobs, the first one being for job i
+            std::deque<std::unique_ptr<Syft::DfaPrefetcher>> prefetchers;
+            std::size_t prefetched = 0;
+            for (std::size_t i = 0; i < jobs.size(); ++i) {
+                if (prefetch > 0) {
+                    for (; prefetched < jobs.size() && prefetched <= i + prefetch; ++prefetched) {
+                        prefetchers.push_back(std::make_unique<Syft::DfaPrefetcher>(jobFormulas(jobs[prefetched], options), options.dfa_cache_directory));
+                    }
+                    prefetchers.front()->collect();
+                    prefetchers.pop_front();
+                }
+                Syft::SynthesisReport report = runLimitedJob(jobs[i], settings);
+                Syft::ExplicitStateDfaMona::clear_provided_dfas();
+                report.append_to(outfile, results_format);
+                printProgress(i + 1, jobs.size(), jobs[i], report.status, report.total_time());
+            }
+        }
+    } else {
+        if (!*agent_formula_opt || !*environment_formula_file || !*partition_file || !*starting_opt || !*alg_id_opt) {
+            std::cerr << "[BeSyft] Options -a, -e, -p, -s and -t are required unless running a batch" << std::endl;
+            return 1;
+        }
+        if (Syft::SynthesisReport::algorithm_name(alg_id) == "") {
+            std::cerr << "[BeSyft] Non-existing algorithm. Terminating" << std::endl;
+            return 1;
+        }
+
+        Job job;
+        job.agent_file = agent_file;
+        job.environment_file = environment_file;
+        job.partition_file = partition_filename;
+        job.starting_player = starting_flag == 1 ? Syft::Player::Agent : Syft::Player::Environment;
+        job.algorithm = alg_id;
+        job.dominance_check = dominance_check;
+
+        JobOutput output;
+        output.print_dot = print_dot;
+        output.interactive = interactive;
+        output.strategy_file = strategy_file;
+
+        double fit_time = options.fit_cache_to_dfas ? fitResourcesToDfas(job, options, cudd_resources) : 0.0;
+
+        std::shared_ptr<Syft::VarMgr> v_mgr = std::make_shared<Syft::VarMgr>(cudd_resources);
+        Syft::configure_reordering(*v_mgr->cudd_mgr(), options);
+
+        Syft::SynthesisReport report;
+        runJob(job, v_mgr, options, output, report);
+        if (fit_time > 0) report.add_phase_time("ltlf2dfa", fit_time);
+
+        if (cudd_statistics) recordCuddStatistics(*v_mgr, report, outfile, results_format);
+
+        if (outfile != "") {
+            report.set_peak_memory(*v_mgr->cudd_mgr());
+            report.append_to(outfile, results_format);
+        }
+
+        if (variable_order_file != "") saveVariableOrder(*v_mgr, variable_order_file);
+    }
+
+    if (trace_file != "") Syft::Tracer::instance().write(trace_file);
 
     return 0;
 
@@ -6,6 +6,7 @@
 
 #include <string>
 #include <cstdio>
+#include <cctype>
 #include <iostream> 
 #include <sstream> 
 
@@ -346,4 +347,74 @@ std::vector<std::string> get_props(formula &f){
 //        cout << f1 << endl;
 //    }
 //    return 0;
-//}
\ No newline at end of file
+//}
+// removes leading and trailing blanks and redundant enclosing parentheses
+static std::string strip_formula(const std::string& ltlf_str)
+{
+    std::string f = ltlf_str;
+    while (true)
+    {
+        std::size_t first = f.find_first_not_of(" \t\r\n");
+        std::size_t last = f.find_last_not_of(" \t\r\n");
+        if (first == std::string::npos) return "";
+        f = f.substr(first, last - first + 1);
+        if (f.front() != '(' || f.back() != ')') return f;
+        // the outer parentheses are redundant only if they match each other
+        int depth = 0;
+        for (std::size_t i = 0; i < f.size(); ++i)
+        {
+            if (f[i] == '(') ++depth;
+            else if (f[i] == ')') --depth;
+            if (depth == 0 && i + 1 < f.size()) return f;
+        }
+        f = f.substr(1, f.size() - 2);
+    }
+}
+
+std::vector<std::string> split_conjunction(const std::string& ltlf_str)
+{
+    std::string f = strip_formula(ltlf_str);
+    std::vector<std::string> conjuncts;
+    std::size_t start = 0;
+    int depth = 0;
+    for (std::size_t i = 0; i < f.size(); ++i)
+    {
+        char c = f[i];
+        if (c == '(') { ++depth; continue; }
+        if (c == ')') { --depth; continue; }
+        if (depth != 0) continue;
+        // binary operators binding weaker than or as strong as the conjunction
+        // make the top-level operator something other than a conjunction
+        bool word_start = i == 0 || !(isalnum(f[i - 1]) || f[i - 1] == '_');
+        bool word_end = i + 1 == f.size() || !(isalnum(f[i + 1]) || f[i + 1] == '_');
+        if (c == '|' || c == '>' || (word_start && word_end && (c == 'U' || c == 'R' || c == 'W' || c == 'M')))
+        {
+            return {f};
+        }
+        if (c == '&')
+        {
+            conjuncts.push_back(f.substr(start, i - start));
+            if (i + 1 < f.size() && f[i + 1] == '&') ++i;
+            start = i + 1;
+        }
+    }
+    if (conjuncts.empty()) return {f};
+    conjuncts.push_back(f.substr(start));
+
+    std::vector<std::string> result;
+    for (const std::string& conjunct : conjuncts)
+    {
+        if (strip_formula(conjunct).empty()) return {f};
+        std::vector<std::string> sub_conjuncts = split_conjunction(conjunct);
+        result.insert(result.end(), sub_conjuncts.begin(), sub_conjuncts.end());
+    }
+    return result;
+}
+
+std::pair<std::vector<std::string>, std::vector<std::string>> split_specifications(const std::string& agent_str,
+                                                                                  const std::string& environment_str,
+                                                                                  bool split)
+{
+    if (!split) return {{agent_str}, {environment_str}};
+    return {split_conjunction(agent_str), split_conjunction(environment_str)};
+}
@@ -3,6 +3,7 @@
 
 #include <spot/tl/formula.hh>
 
+#include <utility>
 #include <vector>
 #include <string>
 
@@ -43,4 +44,18 @@ formula get_nnf(formula &f);
 collect the set of props of a formula
 */
 std::vector<std::string> get_props(formula &f);
+
+/**
+split an LTLf formula string at its top-level conjunctions
+returns the formula itself if it is not a conjunction at top level
+**/
+std::vector<std::string> split_conjunction(const std::string& ltlf_str);
+
+/**
+split an agent goal and an environment specification at their top-level conjunctions if split is set
+returns the conjuncts of the goal and those of the environment specification, in this order
+**/
+std::pair<std::vector<std::string>, std::vector<std::string>> split_specifications(const std::string& agent_str,
+                                                                                  const std::string& environment_str,
+                                                                                  bool split);
 #endif
\ No newline at end of file
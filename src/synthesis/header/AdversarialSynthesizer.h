@@ -14,6 +14,8 @@
 #include"CoOperativeReachabilitySynthesizer.h"
 #include"InputOutputPartition.h"
 #include"Stopwatch.h"
+#include"Reordering.h"
+#include"SynthesisReport.h"
 #include"spotparser.h"
 
 namespace Syft {
@@ -32,7 +34,13 @@ namespace Syft {
 
 			InputOutputPartition partition_;
 
+			SynthesisOptions options_;
+
+			ReorderingClock reordering_clock_;
+
 			std::vector<double> running_times_;
+
+			ProblemSize problem_size_;
 		public:
 		
 			/**
@@ -43,13 +51,28 @@ namespace Syft {
 			* \param environment_assumption LTLf environment specification in Lydia syntax
 			* \param partition Partitioning of problem variables
 			* \param starting_player Player who moves first each turn
+			* \param options Options tuning how the games are solved
 			* 
 			*/
 			AdversarialSynthesizer(std::shared_ptr<VarMgr> var_mgr,
 									std::string agent_specification,
 									std::string environment_specification,
 									InputOutputPartition partition,
-									Player starting_player);
+									Player starting_player,
+									SynthesisOptions options = SynthesisOptions());
+
+			/**
+			 * \brief Returns the formulas translated to DFAs on construction.
+			 *
+			 * These are the formulas E -> Phi and F(true), in the order they are translated.
+			 *
+			 * \param agent_specification LTLf agent goal in Lydia syntax
+			 * \param environment_specification LTLf environment specification in Lydia syntax
+			 * \param options Options of the synthesizer
+			 */
+			static std::vector<std::string> formulas(const std::string& agent_specification,
+													 const std::string& environment_specification,
+													 const SynthesisOptions& options);
 			
 			/**
 			 * @brief Solves symbolic DFA games to compute adversarially and cooperatively winning strategies
@@ -61,9 +84,17 @@ namespace Syft {
 			/**
 			 * @brief Returns running times of major operations during synthesis
 			 * 
+			 * If variable reordering is enabled, the time spent reordering is excluded
+			 * from the other operations and stored last
+			 * 
 			 * @return std::vector<double> storing running times  
 			 */
 			std::vector<double> get_running_times() const;
+
+			/**
+			 * @brief Returns the size of the DFAs and of the arena constructed for synthesis
+			 */
+			ProblemSize get_problem_size() const;
 	};
 }
 #endif
\ No newline at end of file
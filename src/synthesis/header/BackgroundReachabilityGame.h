@@ -0,0 +1,71 @@
+#ifndef BACKGROUND_REACHABILITY_GAME_H
+#define BACKGROUND_REACHABILITY_GAME_H
+
+#include <future>
+#include <memory>
+
+#include "ReachabilitySynthesizer.h"
+
+namespace Syft {
+
+/**
+ * \brief A reachability game solved on another thread, alongside work on the
+ *   manager of its arena.
+ *
+ * A CUDD manager cannot be used by two threads at once, hence the arena and
+ * the goal are transferred to a copy of the variable manager, on which the game
+ * is solved. Only the winning region is transferred back.
+ */
+class BackgroundReachabilityGame {
+ private:
+
+  std::shared_ptr<VarMgr> source_var_mgr_;
+  std::shared_ptr<VarMgr> var_mgr_;
+  // Only used by the thread until it finishes, since BDDs of the same
+  // manager cannot be referenced or dereferenced from two threads
+  SymbolicStateDfa spec_;
+  CUDD::BDD goal_states_;
+  CUDD::BDD state_space_;
+  Player starting_player_;
+  Player protagonist_player_;
+  SynthesisOptions options_;
+  std::future<CUDD::BDD> winning_states_;
+
+ public:
+
+  /**
+   * \brief Starts solving the given reachability game.
+   *
+   * The arguments are as for ReachabilitySynthesizer. The BDDs are transferred
+   * before returning, so the manager of the arena may be used again right away.
+   */
+  BackgroundReachabilityGame(const SymbolicStateDfa& spec,
+                             Player starting_player, Player protagonist_player,
+                             const CUDD::BDD& goal_states,
+                             const CUDD::BDD& state_space,
+                             const SynthesisOptions& options);
+
+  /**
+   * \brief Waits for the game to be solved, discarding its result if it was
+   *   not requested.
+   */
+  ~BackgroundReachabilityGame();
+
+  BackgroundReachabilityGame(const BackgroundReachabilityGame&) = delete;
+  BackgroundReachabilityGame& operator=(const BackgroundReachabilityGame&) = delete;
+
+  /**
+   * \brief Waits for the game to be solved and returns the winning region.
+   *
+   * Rethrows any exception raised while solving the game, such as CUDD
+   * running out of time or memory. Can be called only once.
+   *
+   * \return The winning states of the protagonist, in the manager of the
+   *   arena.
+   */
+  CUDD::BDD winning_states();
+};
+
+}
+
+#endif // BACKGROUND_REACHABILITY_GAME_H
@@ -9,6 +9,7 @@
 #include"SymbolicStateDfa.h"
 #include"Synthesizer.h"
 #include"Transducer.h"
+#include"PartitionedTransitionRelation.h"
 
 namespace Syft {
 
@@ -22,17 +23,29 @@ namespace Syft {
             std::vector<CUDD::BDD> transition_vector_;
             std::unique_ptr<Quantification> quantify_independent_variables_;
             std::unique_ptr<Quantification> quantify_non_state_variables_;
+            SynthesisOptions options_;
+            std::unique_ptr<PartitionedTransitionRelation> transition_relation_;
+
+            CUDD::BDD transitions_into(const CUDD::BDD &states) const;  // Uses the preimage engine selected in the options
 
             CUDD::BDD preimage(const CUDD::BDD &winning_states) const;  // Used to compute function t in symbolic synthesis
 
+            // Incremental version of preimage: only new_states is composed and the result is
+            // accumulated into winning_preimage, which must hold the preimage of the states
+            // passed in earlier calls
+            CUDD::BDD frontier_preimage(const CUDD::BDD &new_states, CUDD::BDD &winning_preimage) const;
+
             CUDD::BDD project_into_states(const CUDD::BDD &winning_moves) const;    // Used to compute function w in symbolic synthesis
 
-            std::unordered_map<int, CUDD::BDD> synthesize_strategy(const CUDD::BDD &winning_moves) const;
+            // Returns a strategy choosing among winning_moves, extracted when first accessed,
+            // or none if the options ask for realizability only
+            LazyTransducer synthesize_strategy(const CUDD::BDD &winning_moves) const;
 
             bool includes_initial_state(const CUDD::BDD &winning_states) const;
 
             public:
-                CoOperativeDfaGameSynthesizer(SymbolicStateDfa spec, Player starting_player, Player protagonist_player);
+                CoOperativeDfaGameSynthesizer(SymbolicStateDfa spec, Player starting_player, Player protagonist_player,
+                                              SynthesisOptions options = SynthesisOptions());
 
                 virtual SynthesisResult run() override = 0;
     };
@@ -0,0 +1,81 @@
+#ifndef CUDD_STATISTICS_H
+#define CUDD_STATISTICS_H
+
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "cuddObj.hh"
+
+namespace Syft {
+
+/**
+ * \brief Statistics of a CUDD manager, either since its construction or over
+ *   a phase of a run.
+ *
+ * Used to tell apart slowdowns due to cache misses, garbage collection and
+ * reordering, and to estimate the memory needed by a run.
+ */
+struct CuddStatistics {
+  /// Peak number of live BDD nodes
+  long peak_live_nodes = 0;
+  /// Peak number of BDD nodes allocated, dead ones included
+  long peak_nodes = 0;
+  /// Number of live BDD nodes
+  long live_nodes = 0;
+  /// Number of lookups in the computed table (cache)
+  double cache_lookups = 0;
+  /// Number of hits in the computed table (cache)
+  double cache_hits = 0;
+  /// Number of garbage collections
+  int garbage_collections = 0;
+  /// Time spent collecting garbage, in milliseconds
+  long garbage_collection_time_ms = 0;
+  /// Number of reorderings
+  unsigned int reorderings = 0;
+  /// Time spent reordering, in milliseconds
+  long reordering_time_ms = 0;
+  /// Memory in use by the manager, in bytes
+  std::size_t memory_in_use = 0;
+
+  /**
+   * \brief Reads the statistics of a manager since its construction.
+   */
+  static CuddStatistics of(const CUDD::Cudd& mgr);
+
+  /**
+   * \brief Returns the statistics of the phase between two readings.
+   *
+   * Counters and times are the differences with \a earlier, while peaks, live
+   * nodes and memory are those of this reading.
+   *
+   * \param earlier The reading at the start of the phase.
+   */
+  CuddStatistics since(const CuddStatistics& earlier) const;
+
+  /**
+   * \brief Returns the fraction of cache lookups that were hits, or 0 without
+   *   lookups.
+   */
+  double cache_hit_rate() const;
+
+  /**
+   * \brief Returns the statistics as named values, in a fixed order.
+   */
+  std::vector<std::pair<std::string, double>> values() const;
+
+  /**
+   * \brief Returns the statistics as a JSON object.
+   */
+  std::string to_json() const;
+
+  /**
+   * \brief Prints the statistics in human-readable form.
+   */
+  void print(std::ostream& out) const;
+};
+
+}
+
+#endif // CUDD_STATISTICS_H
@@ -0,0 +1,66 @@
+#ifndef DFA_CACHE_H
+#define DFA_CACHE_H
+
+#include <optional>
+#include <string>
+
+#include "ExplicitStateDfaMona.h"
+
+namespace Syft {
+
+/**
+ * \brief A persistent on-disk cache of the DFAs of LTLf formulas.
+ *
+ * Entries are addressed by a hash of the normalized formula text and of the
+ * translation settings, and are stored in MONA's export format. Several
+ * processes may share the same cache directory.
+ */
+class DfaCache {
+ private:
+
+  std::string directory_;
+
+  std::string key(const std::string& formula) const;
+  std::string entry_path(const std::string& key, const std::string& extension) const;
+
+ public:
+
+  /**
+   * \brief Creates a cache stored in the given directory.
+   *
+   * The directory is created on the first store if it does not exist.
+   */
+  explicit DfaCache(const std::string& directory);
+
+  /**
+   * \brief Returns the default cache directory.
+   *
+   * This is besyft in $XDG_CACHE_HOME, or in $HOME/.cache if the former is not
+   * set. Returns an empty string if neither variable is set.
+   */
+  static std::string default_directory();
+
+  /**
+   * \brief Loads the DFA of a formula from the cache.
+   *
+   * \param formula An LTLf formula.
+   * \return The cached DFA, or nothing if the formula is not in the cache or its
+   *   entry cannot be read.
+   */
+  std::optional<ExplicitStateDfaMona> load(const std::string& formula) const;
+
+  /**
+   * \brief Stores the DFA of a formula in the cache.
+   *
+   * Failing to write the entry only prints a warning, since the cache is an
+   * optimization.
+   *
+   * \param formula An LTLf formula.
+   * \param dfa The DFA of the formula.
+   */
+  void store(const std::string& formula, const ExplicitStateDfaMona& dfa) const;
+};
+
+}
+
+#endif // DFA_CACHE_H
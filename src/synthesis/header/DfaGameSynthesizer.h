@@ -5,6 +5,7 @@
 #include "SymbolicStateDfa.h"
 #include "Synthesizer.h"
 #include "Transducer.h"
+#include "PartitionedTransitionRelation.h"
 
 namespace Syft {
 
@@ -21,13 +22,38 @@ class DfaGameSynthesizer : public Synthesizer<SymbolicStateDfa> {
   std::vector<CUDD::BDD> transition_vector_;
   std::unique_ptr<Quantification> quantify_independent_variables_;
   std::unique_ptr<Quantification> quantify_non_state_variables_;
+  SynthesisOptions options_;
+  std::unique_ptr<PartitionedTransitionRelation> transition_relation_;
+
+  /**
+   * \brief Computes the transitions that move into \a states.
+   *
+   * Uses the engine selected in the options.
+   */
+  CUDD::BDD transitions_into(const CUDD::BDD& states) const;
 
   CUDD::BDD preimage(const CUDD::BDD& winning_states) const;
 
+  /**
+   * \brief Computes the preimage of a growing set of states incrementally.
+   *
+   * Only \a new_states is composed with the transition function. The
+   * composition is accumulated into \a composed_transitions, which must hold
+   * the composition of every set of states passed in earlier calls, so that
+   * the result is the preimage of the union of all of them.
+   */
+  CUDD::BDD frontier_preimage(const CUDD::BDD& new_states,
+                              CUDD::BDD& composed_transitions) const;
+
   CUDD::BDD project_into_states(const CUDD::BDD& winning_moves) const;
   
-  std::unordered_map<int, CUDD::BDD> synthesize_strategy(
-      const CUDD::BDD& winning_moves) const;
+  /**
+   * \brief Returns a strategy choosing among \a winning_moves, extracted when
+   *   first accessed.
+   *
+   * No strategy is returned if the options ask for realizability only.
+   */
+  LazyTransducer synthesize_strategy(const CUDD::BDD& winning_moves) const;
   
   bool includes_initial_state(const CUDD::BDD& winning_states) const;
   
@@ -40,8 +66,10 @@ class DfaGameSynthesizer : public Synthesizer<SymbolicStateDfa> {
    *
    * \param spec A symbolic-state DFA representing the game's arena.
    * \param starting_player The player that moves first each turn.
+   * \param options Options tuning how the game is solved.
    */
-  DfaGameSynthesizer(SymbolicStateDfa spec, Player starting_player, Player protagonist_player);
+  DfaGameSynthesizer(SymbolicStateDfa spec, Player starting_player, Player protagonist_player,
+                     SynthesisOptions options = SynthesisOptions());
 
 
   /**
@@ -0,0 +1,66 @@
+#ifndef DFA_PREFETCHER_H
+#define DFA_PREFETCHER_H
+
+#include <string>
+#include <vector>
+
+#include <sys/types.h>
+
+namespace Syft {
+
+/**
+ * \brief Translates formulas to DFAs in the background, ahead of the job that
+ *   needs them.
+ *
+ * MONA and Lydia keep global state and are not thread-safe, hence the
+ * formulas are translated by a forked worker process, which passes the DFAs
+ * back through files in MONA's export format. Once collected, the DFAs are
+ * provided to the next job, which finds them in memory, and dropped once the
+ * job has used them.
+ */
+class DfaPrefetcher {
+ private:
+
+  std::vector<std::string> formulas_;
+  std::string directory_;
+  pid_t worker_ = -1;
+
+  void stop();
+
+ public:
+
+  /**
+   * \brief Starts translating some formulas in a worker process.
+   *
+   * Formulas whose DFAs are already memoized are skipped. If the worker cannot
+   * be started, nothing is prefetched and the formulas are translated when
+   * needed.
+   *
+   * \param formulas LTLf formulas.
+   * \param cache_directory The directory of the DFA cache, or an empty string
+   *   to always translate the formulas.
+   */
+  DfaPrefetcher(const std::vector<std::string>& formulas,
+                const std::string& cache_directory);
+
+  DfaPrefetcher(const DfaPrefetcher&) = delete;
+  DfaPrefetcher& operator=(const DfaPrefetcher&) = delete;
+
+  /**
+   * \brief Stops the worker if its DFAs were not collected.
+   */
+  ~DfaPrefetcher();
+
+  /**
+   * \brief Waits for the worker and provides the DFAs it constructed to
+   *   the next job.
+   *
+   * Replaces the DFAs provided by an earlier prefetcher. Formulas the worker
+   * failed to translate are left to the job.
+   */
+  void collect();
+};
+
+}
+
+#endif // DFA_PREFETCHER_H
@@ -0,0 +1,77 @@
+#ifndef DOMINANCE_CHECKER_H
+#define DOMINANCE_CHECKER_H
+
+#include <cstddef>
+#include <vector>
+
+#include <cuddObj.hh>
+
+#include "SymbolicStateDfa.h"
+#include "Synthesizer.h"
+
+namespace Syft {
+
+/**
+ * \brief Checks whether a best-effort strategy is dominant.
+ *
+ * A dominant strategy does not exist if, playing the cooperative strategy, the
+ * agent can reach a cooperative-only state where it has more than one
+ * cooperative move. By default, the states reachable under the cooperative
+ * strategy are computed symbolically, by a forward fixpoint over a partitioned
+ * transition relation. The explicit engine instead enumerates states and
+ * environment moves, storing states as packed bit vectors, on as many threads
+ * as the jobs in the options.
+ */
+class DominanceChecker {
+ private:
+
+  SymbolicStateDfa arena_;
+  SynthesisOptions options_;
+
+  std::vector<CUDD::BDD> strategy_transition_function(
+      const BestEffortSynthesisResult& best_effort_result) const;
+
+  bool reaches_symbolically(
+      const CUDD::BDD& witnesses,
+      const CUDD::BDD& cooperative_only_states,
+      const std::vector<CUDD::BDD>& transition_function) const;
+
+  template <std::size_t Words>
+  bool reaches_explicitly(
+      const CUDD::BDD& witnesses,
+      const CUDD::BDD& cooperative_only_states,
+      const std::vector<CUDD::BDD>& transition_function) const;
+
+ public:
+
+  /**
+   * \brief Constructs a dominance checker for the games on an arena.
+   *
+   * \param arena The arena the games were solved on.
+   * \param options The options of the synthesizer, of which the dominance
+   *   engine and the cluster size of the transition relation are used.
+   */
+  DominanceChecker(const SymbolicStateDfa& arena,
+                   SynthesisOptions options = SynthesisOptions());
+
+  /**
+   * \brief Checks whether the synthesized best-effort strategy is dominant.
+   *
+   * The symbolic engine creates the next-state variables of the arena if they
+   * do not exist yet. The explicit engine falls back to the symbolic one on
+   * arenas with more than 512 state variables or 62 input variables.
+   *
+   * \param best_effort_result The result of best-effort synthesis on the arena.
+   * \param cooperative_moves All cooperative moves in the arena, as a BDD over
+   *   state, input and output variables.
+   * \return Whether no state reachable from the initial state, moving through
+   *   cooperative-only states with the cooperative strategy, witnesses that no
+   *   dominant strategy exists.
+   */
+  bool is_dominant(const BestEffortSynthesisResult& best_effort_result,
+                   const CUDD::BDD& cooperative_moves) const;
+};
+
+}
+
+#endif // DOMINANCE_CHECKER_H
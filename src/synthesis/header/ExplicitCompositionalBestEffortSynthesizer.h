@@ -11,8 +11,13 @@
 #include"SymbolicStateDfa.h"
 #include"ReachabilitySynthesizer.h"
 #include"CoOperativeReachabilitySynthesizer.h"
+#include"BackgroundReachabilityGame.h"
 #include"InputOutputPartition.h"
 #include"Stopwatch.h"
+#include"Reordering.h"
+#include"StrategyExecutor.h"
+#include"SynthesisReport.h"
+#include"DominanceChecker.h"
 #include"spotparser.h"
 #include<unordered_set>
 
@@ -35,8 +40,14 @@ namespace Syft {
 
 			std::vector<double> running_times_;
 
+			ProblemSize problem_size_;
+
 			bool dominance_check_;
 
+			SynthesisOptions options_;
+
+			ReorderingClock reordering_clock_;
+
 			/**
 			 * \brief Gets all cooperative winning moves in arena
 			 * 
@@ -57,7 +68,6 @@ namespace Syft {
 			*/
 			std::unordered_map<int, CUDD::BDD> get_witness_strategy(const CUDD::BDD& witness) const;
 
-			std::vector<std::vector<int>> get_assignments(int n) const;
 		public:
 		
 			/**
@@ -68,6 +78,7 @@ namespace Syft {
 			* \param environment_assumption LTLf environment specification in Lydia syntax
 			* \param partition Partitioning of problem variables
 			* \param starting_player Player who moves first each turn
+			* \param options Options tuning how the games are solved
 			* 
 			*/
             ExplicitCompositionalBestEffortSynthesizer(std::shared_ptr<VarMgr> var_mgr,
@@ -75,7 +86,31 @@ namespace Syft {
 									std::string environment_specification,
 									InputOutputPartition partition,
 									Player starting_player,
-									bool dominance_check);
+									bool dominance_check,
+									SynthesisOptions options = SynthesisOptions());
+
+			/**
+			 * \brief Returns the formulas translated to DFAs on construction.
+			 *
+			 * These are the goal and the assumption, or their top-level conjuncts if
+			 * options.split_conjunctions is set, and F(true), in the order they are translated.
+			 *
+			 * \param agent_specification LTLf agent goal in Lydia syntax
+			 * \param environment_specification LTLf environment specification in Lydia syntax
+			 * \param options Options of the synthesizer
+			 */
+			static std::vector<std::string> formulas(const std::string& agent_specification,
+													 const std::string& environment_specification,
+													 const SynthesisOptions& options);
+
+			/**
+			 * \brief Returns the formulas translated to DFAs on construction, given the
+			 * conjuncts of the goal and of the assumption returned by split_specifications.
+			 *
+			 * \param conjuncts Conjuncts of the goal and conjuncts of the assumption
+			 */
+			static std::vector<std::string> formulas(
+				const std::pair<std::vector<std::string>, std::vector<std::string>>& conjuncts);
 			
 			/**
 			 * @brief Solves symbolic DFA games to compute adversarially and cooperatively winning strategies
@@ -99,10 +134,26 @@ namespace Syft {
 		/**
 		 * @brief Returns running times of major operations during synthesis
 		 * 
+		 * If variable reordering is enabled, the time spent reordering is excluded
+		 * from the other operations and stored last
+		 * 
 		 * @return std::vector<double> storing running times  
 		 */
 		std::vector<double> get_running_times() const;
 
+		/**
+		 * @brief Returns the size of the DFAs and of the arena constructed for synthesis
+		 */
+		ProblemSize get_problem_size() const;
+
+		/**
+		 * \brief Compiles the synthesized best-effort strategy for step-by-step execution
+		 * 
+		 * \param best_effort_result The result of best-effort synthesis
+		 * \return An executor of the strategy on the arena of the games
+		 */
+		StrategyExecutor strategy_executor(const BestEffortSynthesisResult& best_effort_result) const;
+
 		void interactive(
         		const BestEffortSynthesisResult& best_effort_result
     		) const;
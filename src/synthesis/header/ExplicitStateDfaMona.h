@@ -11,6 +11,10 @@ extern "C" {
 #include <mona/mem.h>
 }
 
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
 #include "lydia/dfa/mona_dfa.hpp"
 
 namespace Syft {
@@ -72,10 +76,17 @@ namespace Syft {
         /**
          * \brief Take the product of a vector of DFAs.
          *
+         * DFAs are multiplied pairwise, smallest first, minimizing each
+         * intermediate product. With more than one job, each round multiplies
+         * the smallest DFAs in several disjoint pairs at the same time, each
+         * pair in a separate worker process.
+         *
          * \param dfa_vector The DFAs to be processed.
+         * \param jobs The maximum number of pairs multiplied at the same time.
          * \return The product DFA.
          */
-        static ExplicitStateDfaMona dfa_product(const std::vector<ExplicitStateDfaMona>& dfa_vector);
+        static ExplicitStateDfaMona dfa_product(const std::vector<ExplicitStateDfaMona>& dfa_vector,
+                                                std::size_t jobs = 1);
 
         static ExplicitStateDfaMona dfa_negation(const ExplicitStateDfaMona &d);
 
@@ -105,11 +116,93 @@ namespace Syft {
         /**
          * \brief Construct DFA from a given formula
          *
+         * If a cache directory is given, the DFA is loaded from the cache when
+         * present, and stored in it after translation otherwise.
          *
          * \param formula An LTLf formula.
+         * \param cache_directory The directory of the DFA cache, or an empty
+         *   string to always translate the formula.
          * \return The corresponding explicit-state DFA.
          */
-        static ExplicitStateDfaMona dfa_of_formula(const std::string& formula);
+        static ExplicitStateDfaMona dfa_of_formula(const std::string& formula,
+                                                   const std::string& cache_directory = "");
+
+        /**
+         * \brief Construct DFAs from several formulas concurrently
+         *
+         * MONA and Lydia keep global state and are not thread-safe, hence each
+         * formula is translated in a separate worker process, which passes the
+         * resulting DFA back through a file in MONA's export format.
+         *
+         * \param formulas LTLf formulas.
+         * \param jobs The maximum number of translations running at the same
+         *   time. With at most one job, formulas are translated sequentially in
+         *   the calling process.
+         * \param cache_directory The directory of the DFA cache, or an empty
+         *   string to always translate the formulas. Cached DFAs are loaded
+         *   without starting a worker process.
+         * \return The DFAs of the formulas, in the same order.
+         */
+        static std::vector<ExplicitStateDfaMona> dfas_of_formulas(const std::vector<std::string>& formulas,
+                                                                  std::size_t jobs,
+                                                                  const std::string& cache_directory = "");
+
+        /**
+         * \brief Keep the DFAs of some formulas in memory for the rest of the
+         * process.
+         *
+         * Once translated, the selected formulas, such as F(true) in every job
+         * of a batch, are copied from memory instead of being translated again
+         * or loaded from the DFA cache. DFAs of other formulas are not kept.
+         *
+         * \param formulas The formulas whose DFAs are kept in memory. DFAs of
+         *   formulas no longer selected are dropped.
+         */
+        static void set_memoized_formulas(const std::unordered_set<std::string>& formulas);
+
+        /**
+         * \brief Whether the DFA of a formula is kept in memory.
+         */
+        static bool has_memoized_dfa(const std::string& formula);
+
+        /**
+         * \brief Hand DFAs translated by another process to the next job.
+         *
+         * A provided DFA is used, instead of translating its formula, the
+         * first time the formula is needed, and dropped afterwards.
+         *
+         * \param dfas The DFAs to provide, keyed by their formula.
+         */
+        static void provide_dfas(std::unordered_map<std::string, ExplicitStateDfaMona> dfas);
+
+        /**
+         * \brief Drop the provided DFAs that were not used.
+         */
+        static void clear_provided_dfas();
+
+        /**
+         * \brief Save the DFA to a file in MONA's export format.
+         *
+         * \param filename The file to write.
+         */
+        void dfa_export(const std::string& filename) const;
+
+        /**
+         * \brief Returns the number of nodes in the BDDs of some DFAs, plus
+         *   their number of states.
+         *
+         * A rough measure of the size of their symbolic encoding, known before
+         * they are encoded.
+         */
+        static std::size_t node_count(const std::vector<ExplicitStateDfaMona>& dfas);
+
+        /**
+         * \brief Load a DFA from a file in MONA's export format.
+         *
+         * \param filename The file to read.
+         * \return The DFA stored in the file.
+         */
+        static ExplicitStateDfaMona dfa_import(const std::string& filename);
 
 
 
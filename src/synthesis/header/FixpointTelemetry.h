@@ -0,0 +1,84 @@
+#ifndef FIXPOINT_TELEMETRY_H
+#define FIXPOINT_TELEMETRY_H
+
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include <cuddObj.hh>
+
+#include "VarMgr.h"
+
+namespace Syft {
+
+/**
+ * \brief Records statistics on each iteration of a game's fixpoint.
+ *
+ * Each iteration is appended to a file as a line of JSON with the name of the
+ * game and of its job, the iteration index, the node counts of the winning states and moves,
+ * the number of winning states, the time spent computing the preimage and
+ * projecting it into states, and CUDD's peak number of live nodes so far.
+ * Nothing is measured when no file is given.
+ */
+class FixpointTelemetry {
+ private:
+
+  using Clock = std::chrono::steady_clock;
+
+  std::unique_ptr<std::ofstream> out_;
+  std::string game_;
+  std::string job_;
+  std::shared_ptr<VarMgr> var_mgr_;
+  std::size_t state_variable_count_;
+  std::size_t iteration_;
+  Clock::time_point preimage_start_;
+  Clock::time_point projection_start_;
+
+ public:
+
+  /**
+   * \brief Starts recording the iterations of a game.
+   *
+   * \param filename The file the iterations are appended to. If empty, nothing
+   *   is recorded.
+   * \param game The name of the game, written with every iteration.
+   * \param job The name of the job the game belongs to, written with every
+   *   iteration.
+   * \param var_mgr The manager of the game's variables.
+   * \param automaton_id The ID of the game's arena.
+   */
+  FixpointTelemetry(const std::string& filename,
+                    const std::string& game,
+                    const std::string& job,
+                    std::shared_ptr<VarMgr> var_mgr,
+                    std::size_t automaton_id);
+
+  /**
+   * \brief Returns whether iterations are recorded.
+   */
+  bool enabled() const;
+
+  /**
+   * \brief Marks the start of an iteration, when its preimage is computed.
+   */
+  void start_iteration();
+
+  /**
+   * \brief Marks the end of the preimage and the start of the projection.
+   */
+  void start_projection();
+
+  /**
+   * \brief Marks the end of an iteration and writes its statistics.
+   *
+   * \param winning_states The winning states after the iteration.
+   * \param winning_moves The winning moves after the iteration.
+   */
+  void end_iteration(const CUDD::BDD& winning_states,
+                     const CUDD::BDD& winning_moves);
+};
+
+}
+
+#endif // FIXPOINT_TELEMETRY_H
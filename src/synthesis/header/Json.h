@@ -0,0 +1,60 @@
+#ifndef JSON_H
+#define JSON_H
+
+#include <string>
+
+namespace Syft {
+
+/**
+ * \brief Quotes a string as a JSON string literal.
+ */
+inline std::string json_string(const std::string& text) {
+  std::string quoted = "\"";
+
+  for (char c : text) {
+    switch (c) {
+      case '"': quoted += "\\\""; break;
+      case '\\': quoted += "\\\\"; break;
+      case '\n': quoted += "\\n"; break;
+      case '\t': quoted += "\\t"; break;
+      default: quoted += c;
+    }
+  }
+
+  return quoted + "\"";
+}
+
+/**
+ * \brief Reads a string field of a flat JSON object.
+ *
+ * \param object A JSON object, such as one written with json_string.
+ * \param name The name of the field.
+ * \return The unquoted value of the field, or an empty string if the object
+ *   has no string field with that name.
+ */
+inline std::string json_string_field(const std::string& object,
+                                     const std::string& name) {
+  std::string key = json_string(name) + ":\"";
+  std::size_t position = object.find(key);
+
+  if (position == std::string::npos) return "";
+
+  std::string value;
+  for (position += key.size(); position < object.size(); ++position) {
+    char c = object[position];
+
+    if (c == '"') break;
+    if (c == '\\' && ++position < object.size()) {
+      c = object[position];
+      value += c == 'n' ? '\n' : c == 't' ? '\t' : c;
+    } else {
+      value += c;
+    }
+  }
+
+  return value;
+}
+
+}
+
+#endif // JSON_H
@@ -0,0 +1,83 @@
+#ifndef LAZY_TRANSDUCER_H
+#define LAZY_TRANSDUCER_H
+
+#include <functional>
+#include <memory>
+
+#include "SymbolicStateDfa.h"
+#include "SynthesisOptions.h"
+#include "Transducer.h"
+
+namespace Syft {
+
+/**
+ * \brief A transducer that is only constructed when first accessed.
+ *
+ * Extracting a strategy from the winning moves of a game is expensive, and
+ * wasted on callers that only need realizability or the winning region. Used
+ * as a pointer to the transducer.
+ */
+class LazyTransducer {
+ private:
+
+  mutable std::function<std::unique_ptr<Transducer>()> construct_;
+  mutable std::unique_ptr<Transducer> transducer_;
+
+ public:
+
+  /**
+   * \brief Creates an object holding no strategy.
+   */
+  LazyTransducer() = default;
+
+  /**
+   * \brief Creates an object constructing its transducer on first access.
+   *
+   * \param construct A function constructing the transducer. It is called at
+   *   most once.
+   */
+  explicit LazyTransducer(std::function<std::unique_ptr<Transducer>()> construct);
+
+  /**
+   * \brief Returns a strategy choosing among the winning moves of a game on
+   *   \a spec, extracted when first accessed.
+   *
+   * The arguments are copied, since the strategy may be extracted after the
+   * synthesizer is destroyed. No strategy is returned if the options ask for
+   * realizability only.
+   *
+   * \param spec The arena of the game.
+   * \param initial_vector The initial state of the arena, as an assignment to
+   *   all variables.
+   * \param winning_moves The winning moves of the protagonist.
+   * \param starting_player The player that moves first each turn.
+   * \param protagonist_player The player the strategy is for.
+   * \param options The options of the synthesizer.
+   */
+  static LazyTransducer for_winning_moves(const SymbolicStateDfa& spec,
+                                          std::vector<int> initial_vector,
+                                          const CUDD::BDD& winning_moves,
+                                          Player starting_player,
+                                          Player protagonist_player,
+                                          const SynthesisOptions& options);
+
+  /**
+   * \brief Whether a strategy was synthesized, constructed yet or not.
+   */
+  explicit operator bool() const;
+
+  /**
+   * \brief Returns the transducer, constructing it if needed.
+   *
+   * Throws if no strategy was synthesized.
+   */
+  Transducer* get() const;
+
+  Transducer* operator->() const;
+
+  Transducer& operator*() const;
+};
+
+}
+
+#endif // LAZY_TRANSDUCER_H
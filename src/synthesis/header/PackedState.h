@@ -0,0 +1,187 @@
+#ifndef PACKED_STATE_H
+#define PACKED_STATE_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace Syft {
+
+/**
+ * \brief A state of a symbolic DFA with its bits packed into 64-bit words.
+ *
+ * \tparam Words The number of words, so that small arenas use a single word.
+ */
+template <std::size_t Words>
+struct PackedState {
+  std::array<std::uint64_t, Words> words{};
+
+  /**
+   * \brief Returns the i-th bit of the state.
+   */
+  bool get(std::size_t i) const {
+    return (words[i / 64] >> (i % 64)) & 1;
+  }
+
+  /**
+   * \brief Sets the i-th bit of the state.
+   */
+  void set(std::size_t i, bool value) {
+    std::uint64_t mask = std::uint64_t(1) << (i % 64);
+    words[i / 64] = value ? words[i / 64] | mask : words[i / 64] & ~mask;
+  }
+
+  bool operator==(const PackedState& other) const {
+    return words == other.words;
+  }
+
+  /**
+   * \brief Returns a hash of the state, mixing all bits of each word.
+   */
+  std::size_t hash() const {
+    std::uint64_t hash = 0x9e3779b97f4a7c15ULL;
+    for (std::uint64_t word : words) {
+      hash ^= word;
+      hash *= 0xff51afd7ed558ccdULL;
+      hash ^= hash >> 33;
+    }
+    return hash;
+  }
+};
+
+/**
+ * \brief A set of packed states.
+ *
+ * States are stored inline in a single table with open addressing and linear
+ * probing, so that inserting a state never allocates memory on its own, and
+ * the table is only reallocated when it grows.
+ */
+template <std::size_t Words>
+class PackedStateSet {
+ private:
+
+  std::vector<PackedState<Words>> slots_;
+  std::vector<std::uint8_t> occupied_;
+  std::size_t size_;
+
+  // Returns the slot holding the state, or the empty slot where it belongs
+  std::size_t find(const PackedState<Words>& state) const {
+    std::size_t mask = slots_.size() - 1;
+    std::size_t slot = state.hash() & mask;
+
+    while (occupied_[slot] && !(slots_[slot] == state)) {
+      slot = (slot + 1) & mask;
+    }
+
+    return slot;
+  }
+
+  void grow() {
+    std::vector<PackedState<Words>> slots = std::move(slots_);
+    std::vector<std::uint8_t> occupied = std::move(occupied_);
+
+    slots_.assign(slots.size() * 2, PackedState<Words>());
+    occupied_.assign(slots.size() * 2, 0);
+
+    for (std::size_t i = 0; i < slots.size(); ++i) {
+      if (occupied[i]) {
+        std::size_t slot = find(slots[i]);
+        slots_[slot] = slots[i];
+        occupied_[slot] = 1;
+      }
+    }
+  }
+
+ public:
+
+  /**
+   * \brief Creates an empty set.
+   *
+   * \param capacity The number of states the set can hold before growing.
+   */
+  explicit PackedStateSet(std::size_t capacity = 1024)
+      : size_(0) {
+    std::size_t slot_count = 2;
+    while (slot_count < 2 * capacity) slot_count *= 2;
+    slots_.assign(slot_count, PackedState<Words>());
+    occupied_.assign(slot_count, 0);
+  }
+
+  /**
+   * \brief Adds a state to the set.
+   *
+   * \return Whether the state was not in the set yet.
+   */
+  bool insert(const PackedState<Words>& state) {
+    // Keeps the load factor at most 1/2, so that probe sequences stay short
+    if (2 * (size_ + 1) > slots_.size()) grow();
+
+    std::size_t slot = find(state);
+    if (occupied_[slot]) return false;
+
+    slots_[slot] = state;
+    occupied_[slot] = 1;
+    ++size_;
+    return true;
+  }
+
+  /**
+   * \brief Returns whether a state is in the set.
+   */
+  bool contains(const PackedState<Words>& state) const {
+    return occupied_[find(state)];
+  }
+
+  /**
+   * \brief Returns the number of states in the set.
+   */
+  std::size_t size() const {
+    return size_;
+  }
+};
+
+/**
+ * \brief A set of packed states that can be updated by several threads.
+ *
+ * The set is split into shards, each with its own lock, chosen by the high
+ * bits of the hash of a state. Threads inserting different states rarely
+ * wait for each other.
+ */
+template <std::size_t Words>
+class ConcurrentPackedStateSet {
+ private:
+
+  struct Shard {
+    std::mutex mutex;
+    PackedStateSet<Words> states;
+  };
+
+  std::vector<Shard> shards_;
+
+ public:
+
+  /**
+   * \brief Creates an empty set.
+   *
+   * \param shard_count The number of independently locked shards.
+   */
+  explicit ConcurrentPackedStateSet(std::size_t shard_count)
+      : shards_(shard_count == 0 ? 1 : shard_count) {}
+
+  /**
+   * \brief Adds a state to the set.
+   *
+   * \return Whether the state was not in the set yet.
+   */
+  bool insert(const PackedState<Words>& state) {
+    Shard& shard = shards_[(state.hash() >> 32) % shards_.size()];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.states.insert(state);
+  }
+};
+
+}
+
+#endif // PACKED_STATE_H
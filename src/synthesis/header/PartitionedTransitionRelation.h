@@ -0,0 +1,113 @@
+#ifndef PARTITIONED_TRANSITION_RELATION_H
+#define PARTITIONED_TRANSITION_RELATION_H
+
+#include <memory>
+#include <vector>
+
+#include <cuddObj.hh>
+
+#include "SymbolicStateDfa.h"
+
+namespace Syft {
+
+/**
+ * \brief The transition relation T(Z, X, Y, Z') of a symbolic-state DFA.
+ *
+ * The relation is kept as a conjunction of clusters, each grouping the bit
+ * relations z'_i <-> f_i(Z, X, Y) of several state variables, so that it is
+ * never built as a single BDD. Clusters are conjoined in an order that allows
+ * quantifying variables as early as possible. Since that order depends on the
+ * variables being quantified, a relation computes either preimages or, if
+ * constructed with \a forward, images.
+ */
+class PartitionedTransitionRelation {
+ private:
+
+  std::shared_ptr<VarMgr> var_mgr_;
+  std::vector<CUDD::BDD> state_variables_;
+  std::vector<CUDD::BDD> next_state_variables_;
+  std::vector<CUDD::BDD> clusters_;
+  std::vector<CUDD::BDD> quantification_cubes_;
+  bool forward_;
+
+  PartitionedTransitionRelation(const SymbolicStateDfa& dfa,
+                                const std::vector<CUDD::BDD>& transition_function,
+                                std::size_t cluster_size,
+                                const CUDD::BDD& existential_cube,
+                                bool forward);
+
+  std::vector<CUDD::BDD> cluster(const std::vector<CUDD::BDD>& bit_relations,
+                                 std::size_t cluster_size) const;
+
+  void schedule(const CUDD::BDD& quantified_cube);
+
+ public:
+
+  /**
+   * \brief Constructs the transition relation of a symbolic-state DFA.
+   *
+   * Creates the next-state variables of the DFA if they do not exist yet.
+   *
+   * \param dfa The DFA whose transition function to use.
+   * \param cluster_size The maximum number of BDD nodes in a cluster. Bit
+   *   relations larger than this form a cluster of their own. If 0, every bit
+   *   relation is a separate cluster.
+   * \param existential_cube A cube of input and output variables to be
+   *   existentially quantified together with the next-state variables.
+   */
+  PartitionedTransitionRelation(const SymbolicStateDfa& dfa,
+                                std::size_t cluster_size,
+                                const CUDD::BDD& existential_cube);
+
+  /**
+   * \brief Constructs a transition relation for computing images.
+   *
+   * Creates the next-state variables of the DFA if they do not exist yet.
+   *
+   * \param dfa The DFA whose state variables to use.
+   * \param transition_function A transition function over the state variables
+   *   of the DFA, such as the transition function of the DFA with the outputs
+   *   fixed by a strategy.
+   * \param cluster_size The maximum number of BDD nodes in a cluster.
+   * \param existential_cube A cube of input and output variables to be
+   *   existentially quantified together with the state variables.
+   */
+  static PartitionedTransitionRelation forward(
+      const SymbolicStateDfa& dfa,
+      const std::vector<CUDD::BDD>& transition_function,
+      std::size_t cluster_size,
+      const CUDD::BDD& existential_cube);
+
+  /**
+   * \brief Computes the transitions that move into a set of states.
+   *
+   * Computes the relational product
+   * Exists Z' E. T(Z, X, Y, Z') & S(Z'), where E are the variables in the
+   * existential cube given on construction. Without such variables, the
+   * result is the same as composing \a states with the transition function.
+   *
+   * \param states A BDD over the state variables of the DFA.
+   * \return A BDD over the state, input and output variables.
+   */
+  CUDD::BDD transitions_into(const CUDD::BDD& states) const;
+
+  /**
+   * \brief Computes the image of a set of states.
+   *
+   * Computes Exists Z E. T(Z, X, Y, Z') & S(Z), renaming Z' to Z. Only
+   * available on relations constructed with \a forward.
+   *
+   * \param states A BDD over the state variables of the DFA.
+   * \return A BDD over the state variables of the successors of \a states.
+   */
+  CUDD::BDD image(const CUDD::BDD& states) const;
+
+  /**
+   * \brief Returns the number of clusters the relation is partitioned into.
+   */
+  std::size_t cluster_count() const;
+};
+
+}
+
+#endif // PARTITIONED_TRANSITION_RELATION_H
@@ -24,9 +24,11 @@ class ReachabilitySynthesizer : public DfaGameSynthesizer {
    * \param spec A symbolic-state DFA representing the reachability game.
    * \param starting_player The player that moves first each turn.
    * \param goal_states The set of states that the agent must reach to win.
+   * \param options Options tuning how the game is solved.
    */
   ReachabilitySynthesizer(SymbolicStateDfa spec, Player starting_player, Player protagonist_player,
-			  CUDD::BDD goal_states, CUDD::BDD state_space);
+			  CUDD::BDD goal_states, CUDD::BDD state_space,
+			  SynthesisOptions options = SynthesisOptions());
 
     /**
      * \brief Solves the reachability game.
@@ -34,7 +36,7 @@ class ReachabilitySynthesizer : public DfaGameSynthesizer {
      * \return The result consists of
      * realizability
      * a set of agent winning states
-     * a transducer representing a winning strategy or nullptr if the game is unrealizable.
+     * a transducer representing a strategy choosing winning moves, constructed when first accessed, or none if the options ask for realizability only.
      */
   virtual SynthesisResult run() final;
 
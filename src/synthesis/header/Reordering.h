@@ -0,0 +1,72 @@
+#ifndef REORDERING_H
+#define REORDERING_H
+
+#include <memory>
+
+#include <cuddObj.hh>
+
+#include "SynthesisOptions.h"
+
+namespace Syft {
+
+/**
+ * \brief Returns the CUDD reordering heuristic for a reordering method.
+ */
+Cudd_ReorderingType reordering_type(ReorderingMethod method);
+
+/**
+ * \brief Returns whether the options make CUDD reorder the variables at all.
+ */
+bool reordering_enabled(const SynthesisOptions& options);
+
+/**
+ * \brief Sets the dynamic reordering method and thresholds of a manager.
+ *
+ * \param mgr The manager to configure.
+ * \param options The options of which the reordering method, whether to
+ *   reorder dynamically and the thresholds are used.
+ */
+void configure_reordering(const CUDD::Cudd& mgr,
+                          const SynthesisOptions& options);
+
+/**
+ * \brief Reorders the variables of a manager with the method in the options.
+ */
+void reorder_variables(const CUDD::Cudd& mgr, const SynthesisOptions& options);
+
+/**
+ * \brief Keeps track of the time CUDD spends reordering variables, so that it
+ *   can be reported as a phase of its own.
+ */
+class ReorderingClock {
+ private:
+
+  std::shared_ptr<CUDD::Cudd> mgr_;
+  long last_reordering_time_;
+  double total_;
+
+ public:
+
+  /**
+   * \brief Starts counting the reordering time of a manager from now on.
+   */
+  explicit ReorderingClock(std::shared_ptr<CUDD::Cudd> mgr);
+
+  /**
+   * \brief Removes from the time of a phase the time spent reordering.
+   *
+   * \param seconds The time of a phase that just ended.
+   * \return The time of the phase minus the time spent reordering since the
+   *   previous phase, which is added to the reordering phase instead.
+   */
+  double exclude(double seconds);
+
+  /**
+   * \brief Returns the time in seconds spent reordering in all phases so far.
+   */
+  double total() const;
+};
+
+}
+
+#endif // REORDERING_H
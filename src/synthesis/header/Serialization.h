@@ -0,0 +1,44 @@
+#ifndef SERIALIZATION_H
+#define SERIALIZATION_H
+
+#include <cstdio>
+#include <memory>
+#include <string>
+
+namespace Syft {
+
+/**
+ * \brief A file that is closed when the pointer goes out of scope.
+ */
+using FilePointer = std::unique_ptr<FILE, int (*)(FILE*)>;
+
+/**
+ * \brief Opens a file, throwing an exception if it cannot be opened.
+ *
+ * \param filename The name of the file.
+ * \param mode The mode to open the file in, as in fopen.
+ */
+FilePointer open_file(const std::string& filename, const char* mode);
+
+/**
+ * \brief Reads the next whitespace-separated token from a file.
+ *
+ * Throws an exception if the end of the file is reached first.
+ */
+std::string read_token(FILE* file);
+
+/**
+ * \brief Reads the next token from a file as a non-negative number.
+ */
+std::size_t read_number(FILE* file);
+
+/**
+ * \brief Reads the next token from a file and checks it has a given value.
+ *
+ * Throws an exception if the token is different.
+ */
+void expect_token(FILE* file, const std::string& expected);
+
+}
+
+#endif // SERIALIZATION_H
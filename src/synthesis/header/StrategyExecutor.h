@@ -0,0 +1,144 @@
+#ifndef STRATEGY_EXECUTOR_H
+#define STRATEGY_EXECUTOR_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <cuddObj.hh>
+
+#include "SymbolicStateDfa.h"
+#include "Synthesizer.h"
+
+namespace Syft {
+
+/**
+ * \brief Executes a best-effort strategy one step at a time.
+ *
+ * The strategy follows the adversarial strategy in the winning region and the
+ * cooperative strategy in the rest of the cooperative region. It is compiled on
+ * construction, so that a step only reads precomputed arrays and allocates no
+ * memory. If few states are reachable under the strategy, it is compiled to an
+ * explicit table indexed by state and input. Otherwise the output function and
+ * the transition function are each packed into multi-terminal ADDs whose
+ * leaves hold many bits at once, and the ADDs are flattened into arrays, so
+ * that a step walks one path per ADD instead of evaluating one BDD per bit.
+ */
+class StrategyExecutor {
+ public:
+
+  /**
+   * \brief The region of the arena the current state belongs to.
+   */
+  enum class Region {
+    /// The agent plays the adversarial strategy
+    Winning,
+    /// The agent plays the cooperative strategy
+    Cooperative,
+    /// The strategy has no move
+    Losing
+  };
+
+ private:
+
+  // A flattened ADD. Node 0 is the root. Leaves have a negative variable and
+  // their value at values[then_child].
+  struct Node {
+    int variable;
+    std::uint32_t then_child;
+    std::uint32_t else_child;
+  };
+
+  struct FlatAdd {
+    std::vector<Node> nodes;
+    std::vector<std::uint64_t> values;
+  };
+
+  std::vector<int> input_indices_;
+  std::vector<int> output_indices_;
+  std::vector<int> state_indices_;
+  std::vector<int> initial_state_;
+
+  // Value of every BDD variable, indexed by variable index
+  std::vector<char> assignment_;
+  std::vector<int> next_state_;
+
+  std::vector<FlatAdd> output_adds_;
+  std::vector<FlatAdd> transition_adds_;
+  FlatAdd region_add_;
+
+  // Explicit table, empty if the strategy is executed symbolically
+  std::size_t input_combinations_;
+  std::vector<std::uint64_t> table_outputs_;
+  std::vector<std::uint32_t> table_successors_;
+  std::vector<Region> table_regions_;
+
+  std::uint32_t current_state_;
+  Region region_;
+
+  static FlatAdd flatten(const CUDD::ADD& add);
+
+  static std::uint64_t evaluate(const FlatAdd& add,
+                                const std::vector<char>& assignment);
+
+  static void evaluate_bits(const std::vector<FlatAdd>& adds,
+                            const std::vector<char>& assignment,
+                            std::vector<int>& bits);
+
+  static std::vector<FlatAdd> pack(const std::shared_ptr<VarMgr>& var_mgr,
+                                   const std::vector<CUDD::BDD>& bits);
+
+  static Region to_region(std::uint64_t value);
+
+  bool tabulate(std::size_t max_table_size);
+
+ public:
+
+  /**
+   * \brief Compiles the best-effort strategy computed on an arena.
+   *
+   * Throws if the result holds no strategies, as when synthesis only decides
+   * realizability.
+   *
+   * \param arena The arena the games were solved on.
+   * \param result The result of best-effort synthesis on \a arena.
+   * \param max_table_size The maximum number of entries, one per reachable
+   *   state and input assignment, of an explicit table. If the table would be
+   *   larger, the strategy is executed symbolically.
+   */
+  StrategyExecutor(const SymbolicStateDfa& arena,
+                   const BestEffortSynthesisResult& result,
+                   std::size_t max_table_size = 1 << 20);
+
+  /**
+   * \brief Moves back to the initial state of the arena.
+   */
+  void reset();
+
+  /**
+   * \brief Plays one step of the strategy.
+   *
+   * \param inputs The value of each input variable, in the order of
+   *   VarMgr::input_variable_labels.
+   * \param outputs Set to the value of each output variable, in the order of
+   *   VarMgr::output_variable_labels. Must already have one element per
+   *   output variable.
+   * \return Whether the strategy had a move. If false, the current state is in
+   *   the losing region and neither the state nor \a outputs change.
+   */
+  bool step(const std::vector<int>& inputs, std::vector<int>& outputs);
+
+  /**
+   * \brief Returns the region of the current state.
+   */
+  Region region() const;
+
+  /**
+   * \brief Returns whether the strategy was compiled to an explicit table.
+   */
+  bool is_tabulated() const;
+};
+
+}
+
+#endif // STRATEGY_EXECUTOR_H
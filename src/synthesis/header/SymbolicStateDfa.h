@@ -128,6 +128,34 @@ class SymbolicStateDfa {
    */
   void dump_dot(const std::string& filename) const;
 
+  /**
+   * \brief Saves the DFA to a file.
+   *
+   * The BDDs are stored in DDDMP's binary format, after the variables of the
+   * variable manager, so that the DFA can be loaded in a separate process.
+   *
+   * \param filename The name of the file to save the DFA to.
+   */
+  void save(const std::string& filename) const;
+
+  /**
+   * \brief Loads a DFA saved with \a save.
+   *
+   * \param filename The name of the file to load the DFA from.
+   * \return The DFA, with a new variable manager where every variable has the
+   *   same index as when the DFA was saved.
+   */
+  static SymbolicStateDfa load(const std::string& filename);
+
+  /**
+   * \brief Copies the DFA into another variable manager.
+   *
+   * \param var_mgr A manager with the same variables as the manager of the
+   *   DFA, such as one created by VarMgr::copy.
+   * \return The same DFA, with its BDDs in the CUDD manager of \a var_mgr.
+   */
+  SymbolicStateDfa transfer(std::shared_ptr<VarMgr> var_mgr) const;
+
     /**
      * \brief Returns a product of two symbolic DFAs.
      *
@@ -0,0 +1,242 @@
+#ifndef SYNTHESIS_OPTIONS_H
+#define SYNTHESIS_OPTIONS_H
+
+#include <cstddef>
+#include <string>
+
+namespace Syft {
+
+/**
+ * \brief How the transitions into a set of states are computed.
+ */
+enum class PreimageEngine {
+  /// Composes the set of states with the transition function
+  Compose,
+  /// Conjoins the set of states with a partitioned transition relation
+  Relational
+};
+
+/**
+ * \brief How the variables are ordered once the arena is constructed.
+ */
+enum class VariableOrder {
+  /// Keeps the order in which the variables were created
+  Creation,
+  /// Places the state variables of each automaton, in order, above all
+  /// named variables
+  StateBitsOnTop,
+  /// Interleaves the state variables of the automata bit by bit, above all
+  /// named variables
+  Interleaved,
+  /// Places state variables on top, then the variables of the player moving
+  /// first above those of the other player
+  PlayerTurn,
+  /// Orders propositions so that those read by the same automata are close,
+  /// with the state variables of each automaton above its first proposition
+  FormulaStructure
+};
+
+/**
+ * \brief The heuristic used to reorder the variables.
+ */
+enum class ReorderingMethod {
+  /// Moves each variable to its best position in turn
+  Sift,
+  /// Sifting that keeps symmetric variables together
+  SymmetricSift,
+  /// Sifting that moves groups of variables, such as those of an automaton
+  GroupSift,
+  /// Permutes windows of four adjacent variables
+  Window,
+  /// Simulated annealing
+  Annealing
+};
+
+/**
+ * \brief How the states reachable in the dominance check are computed.
+ */
+enum class DominanceEngine {
+  /// Computes images of sets of states with a partitioned transition relation
+  Symbolic,
+  /// Enumerates states and environment moves one at a time
+  Explicit
+};
+
+/**
+ * \brief Tuning options shared by the synthesizers and the games they solve.
+ *
+ * A default-constructed object reproduces the default behaviour of BeSyft.
+ */
+struct SynthesisOptions {
+  /**
+   * \brief Whether fixpoint iterations compose only the newly won states.
+   *
+   * When false, the preimage of the whole winning region is recomputed at
+   * every iteration.
+   */
+  bool frontier_preimage = true;
+
+  /**
+   * \brief The engine used to compute preimages in the games.
+   */
+  PreimageEngine preimage_engine = PreimageEngine::Compose;
+
+  /**
+   * \brief Maximum number of BDD nodes in a cluster of the transition relation.
+   *
+   * Only used by the relational engine. If 0, each state bit has its own
+   * cluster.
+   */
+  std::size_t cluster_size = 5000;
+
+  /**
+   * \brief Maximum number of worker processes translating formulas to DFAs or
+   *   multiplying DFAs concurrently, and of threads exploring the arena in the
+   *   explicit dominance check.
+   *
+   * With at most one job, DFAs are constructed sequentially in the calling
+   * process, and the arena is explored by the calling thread.
+   */
+  std::size_t jobs = 1;
+
+  /**
+   * \brief Whether games only decide realizability, without synthesizing
+   *   strategies.
+   *
+   * Strategies are otherwise extracted from the winning moves when first
+   * accessed.
+   */
+  bool realizability_only = false;
+
+  /**
+   * \brief Whether extracted strategies are checked to implement every
+   *   winning move.
+   */
+  bool verify_strategies = true;
+
+  /**
+   * \brief Whether compositional synthesizers split the goal and the
+   *   assumption into top-level conjuncts, with one DFA per conjunct.
+   */
+  bool split_conjunctions = false;
+
+  /**
+   * \brief Whether best-effort synthesizers solve the game against the
+   *   negated assumption on another thread, alongside the adversarial game.
+   *
+   * That game is solved on a copy of the variable manager, so the two games
+   * may together use up to twice the memory of one.
+   */
+  bool concurrent_games = false;
+
+  /**
+   * \brief Directory of the on-disk cache of the DFAs of formulas.
+   *
+   * If empty, formulas are always translated.
+   */
+  std::string dfa_cache_directory;
+
+  /**
+   * \brief Whether the limits of the CUDD cache are sized from the DFAs
+   *   before encoding them.
+   */
+  bool fit_cache_to_dfas = false;
+
+  /**
+   * \brief The engine used to explore the arena in the dominance check.
+   */
+  DominanceEngine dominance_engine = DominanceEngine::Symbolic;
+
+  /**
+   * \brief The variable ordering installed once the arena is constructed.
+   */
+  VariableOrder variable_order = VariableOrder::Creation;
+
+  /**
+   * \brief File with a variable ordering saved by a previous run.
+   *
+   * If not empty, the saved ordering is installed instead of
+   * \a variable_order.
+   */
+  std::string variable_order_file;
+
+  /**
+   * \brief Whether dynamic reordering keeps the state variables of each
+   *   automaton together.
+   */
+  bool group_automaton_variables = false;
+
+  /**
+   * \brief The heuristic used whenever the variables are reordered.
+   */
+  ReorderingMethod reordering_method = ReorderingMethod::Sift;
+
+  /**
+   * \brief Whether CUDD reorders the variables whenever the number of BDD nodes
+   *   reaches a threshold.
+   */
+  bool dynamic_reordering = false;
+
+  /**
+   * \brief The number of BDD nodes at which the first dynamic reordering
+   *   occurs.
+   *
+   * If 0, CUDD's default is used.
+   */
+  unsigned int reordering_threshold = 0;
+
+  /**
+   * \brief How much a BDD may grow while moving a variable during
+   *   reordering, as a factor of its size before the move.
+   *
+   * If 0, CUDD's default is used.
+   */
+  double max_growth = 0.0;
+
+  /**
+   * \brief Whether the variables are reordered once the arena is constructed.
+   */
+  bool reorder_after_arena = false;
+
+  /**
+   * \brief Number of fixpoint iterations between reorderings in the games.
+   *
+   * If 0, the games do not reorder the variables.
+   */
+  std::size_t reorder_interval = 0;
+
+  /**
+   * \brief File the statistics of every fixpoint iteration in the games are
+   *   appended to, as JSON lines.
+   *
+   * If empty, no statistics are recorded.
+   */
+  std::string telemetry_file;
+
+  /**
+   * \brief The role of the game being solved, such as adversarial,
+   *   negated-environment or cooperative, written with its statistics.
+   *
+   * If empty, the statistics name the kind of game.
+   */
+  std::string telemetry_game;
+
+  /**
+   * \brief Identifies the job the games belong to, written with their
+   *   statistics.
+   */
+  std::string telemetry_job;
+
+  /**
+   * \brief Returns a copy of the options for solving the game with a role.
+   */
+  SynthesisOptions for_game(const std::string& game) const {
+    SynthesisOptions options = *this;
+    options.telemetry_game = game;
+    return options;
+  }
+};
+
+}
+
+#endif // SYNTHESIS_OPTIONS_H
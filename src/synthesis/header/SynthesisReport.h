@@ -0,0 +1,245 @@
+#ifndef SYNTHESIS_REPORT_H
+#define SYNTHESIS_REPORT_H
+
+#include <optional>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "CuddStatistics.h"
+#include "ExplicitStateDfaMona.h"
+#include "Player.h"
+#include "SymbolicStateDfa.h"
+#include "Synthesizer.h"
+
+namespace Syft {
+
+/**
+ * \brief The size of the automata a synthesizer constructs.
+ */
+struct ProblemSize {
+  /// Number of states of each DFA encoded symbolically
+  std::vector<std::size_t> dfa_states;
+  /// Number of state variables of the arena
+  std::size_t arena_state_bits = 0;
+  /// Number of BDD nodes in the transition function of the arena
+  std::size_t arena_nodes = 0;
+
+  /**
+   * \brief Measures the DFAs encoded symbolically and the arena built from them.
+   */
+  static ProblemSize of(const std::vector<ExplicitStateDfaMona>& dfas,
+                        const SymbolicStateDfa& arena);
+};
+
+/**
+ * \brief The formats in which results are saved.
+ */
+enum class ResultsFormat {
+  /// One comma-separated row per run, in the layout of EmpiricalResults
+  Csv,
+  /// One JSON object per run and per line
+  JsonLines
+};
+
+/**
+ * \brief The outcome of a synthesis problem.
+ */
+enum class Outcome {
+  /// The agent has a winning strategy
+  Adversarial,
+  /// The agent has no winning strategy, but has a cooperatively winning one
+  Cooperative,
+  /// The agent has no winning strategy, nor one that is checked to be
+  /// cooperatively winning
+  Unrealizable
+};
+
+/**
+ * \brief Whether a run completed.
+ */
+enum class RunStatus {
+  Completed,
+  /// The run exceeded its time limit
+  TimedOut,
+  /// The run exceeded its memory limit or memory was exhausted
+  OutOfMemory,
+  /// The run stopped with an error
+  Failed
+};
+
+/**
+ * \brief The results of a run of BeSyft, saved by -f.
+ *
+ * Every run produces the same fields, regardless of the algorithm. Phase
+ * timings are named, so that adding a phase does not shift the others.
+ */
+struct SynthesisReport {
+  /// The number of the algorithm, as given to -t
+  int algorithm_id = 0;
+  /// The name of the algorithm
+  std::string algorithm;
+  std::string agent_file;
+  std::string environment_file;
+  std::string partition_file;
+  Player starting_player = Player::Agent;
+  /// Whether the job asked for the dominance check, as with -c
+  bool dominance_check = false;
+  /// Whether the algorithm performs best-effort rather than reactive synthesis
+  bool best_effort = false;
+  /// Running time of each phase, in seconds
+  std::vector<std::pair<std::string, double>> phase_times;
+  Outcome outcome = Outcome::Unrealizable;
+  /// Whether the existence of a dominant strategy was checked
+  bool dominance_checked = false;
+  /// Whether a dominant strategy exists, if checked
+  bool dominant = false;
+  ProblemSize problem_size;
+  /// Number of BDD nodes in the adversarially winning states
+  std::size_t adversarial_winning_nodes = 0;
+  /// Number of BDD nodes in the cooperatively winning states, for
+  /// best-effort synthesis
+  std::size_t cooperative_winning_nodes = 0;
+  /// Peak number of live BDD nodes
+  long peak_live_nodes = 0;
+  /// Peak resident set size of the process, in kilobytes
+  long peak_rss_kb = 0;
+  /// Statistics of the CUDD manager at the end of the run, if recorded
+  std::optional<CuddStatistics> cudd_statistics;
+  RunStatus status = RunStatus::Completed;
+
+  /**
+   * \brief Returns the name of an algorithm, or an empty string if there is
+   *   no algorithm with that number.
+   *
+   * \param algorithm_id The number of the algorithm, as given to -t.
+   */
+  static std::string algorithm_name(int algorithm_id);
+
+  /**
+   * \brief Returns the name of a status, as saved in JSON results.
+   */
+  static std::string status_name(RunStatus status);
+
+  /**
+   * \brief Records that the run stopped before completing.
+   *
+   * The phase timings are replaced by a single "incomplete" phase.
+   *
+   * \param status Why the run stopped.
+   * \param elapsed The time spent before the run stopped, in seconds.
+   */
+  void set_failure(RunStatus status, double elapsed);
+
+  /**
+   * \brief Records the result of best-effort synthesis.
+   */
+  void set_result(const BestEffortSynthesisResult& result,
+                  bool dominance_checked);
+
+  /**
+   * \brief Records the result of reactive synthesis.
+   */
+  void set_result(const SynthesisResult& result);
+
+  /**
+   * \brief Names the running times returned by a synthesizer.
+   *
+   * Must be called after the result is recorded, since the phases depend on
+   * the kind of synthesis and on whether dominance was checked.
+   *
+   * \param running_times The running times, as returned by
+   *   get_running_times.
+   * \param reordering Whether the time spent reordering is stored last.
+   */
+  void set_phase_times(const std::vector<double>& running_times,
+                       bool reordering);
+
+  /**
+   * \brief Adds time spent outside the synthesizer to a phase, recorded as a
+   *   new phase if it did not run.
+   */
+  void add_phase_time(const std::string& phase, double seconds);
+
+  /**
+   * \brief Records the peak memory used so far.
+   */
+  void set_peak_memory(const CUDD::Cudd& mgr);
+
+  /**
+   * \brief Returns the running time of a phase, or a negative value if the
+   *   phase did not run.
+   */
+  double phase_time(const std::string& phase) const;
+
+  /**
+   * \brief Returns the total running time, in seconds.
+   */
+  double total_time() const;
+
+  /**
+   * \brief Returns the results as a JSON object.
+   */
+  std::string to_json() const;
+
+  /**
+   * \brief Returns the results as a row of the CSV files in EmpiricalResults.
+   *
+   * The columns are the algorithm, the agent and environment files, the
+   * starting player, the LTLf-to-DFA, DFA-to-symbolic, adversarial game,
+   * cooperative game and dominance times, the total time, the realizability
+   * and the dominance. Times of phases that did not run are NA. Runs that did
+   * not complete have Timeout, Memout or Error as realizability.
+   */
+  std::string to_csv() const;
+
+  /**
+   * \brief Returns a key identifying the job, made of the algorithm, the agent
+   *   and environment files, the starting player, the partition file and
+   *   whether the job asked for the dominance check.
+   */
+  std::string job_key() const;
+
+  /**
+   * \brief Returns the key of the job whose results are saved in a JSON row.
+   */
+  static std::string job_key(const std::string& line);
+
+  /**
+   * \brief Returns the name of the file listing the keys of the jobs whose
+   *   results are saved as CSV rows in \a filename.
+   *
+   * CSV rows keep the columns of EmpiricalResults, which do not identify a
+   * job on their own.
+   */
+  static std::string jobs_filename(const std::string& filename);
+
+  /**
+   * \brief Returns the keys of the jobs whose results are saved in a results
+   *   file, in either format.
+   */
+  static std::unordered_set<std::string> saved_job_keys(const std::string& filename);
+
+  /**
+   * \brief Appends the results to a file, and the key of the job to the
+   *   jobs file of CSV results.
+   */
+  void append_to(const std::string& filename, ResultsFormat format) const;
+
+  /**
+   * \brief Appends the key of the job to the jobs file of \a filename.
+   */
+  void append_key_to(const std::string& filename) const;
+
+  /**
+   * \brief Appends the CUDD statistics to <filename>.cudd as a JSON line
+   *   holding the key of the job, for CSV results, which have no column for
+   *   them.
+   */
+  void append_cudd_statistics_to(const std::string& filename) const;
+};
+
+}
+
+#endif // SYNTHESIS_REPORT_H
@@ -3,26 +3,17 @@
 
 #include <memory>
 
+#include "LazyTransducer.h"
+#include "SynthesisOptions.h"
 #include "Transducer.h"
 #include <tuple>
 
 namespace Syft {
 
-    struct VectorHash {
-    size_t operator()(const std::vector<int>& v) const {
-        std::hash<int> hasher;
-        size_t seed = 0;
-        for (int i : v) {
-            seed ^= hasher(i) + 0x9e3779b9 + (seed<<6) + (seed>>2);
-        }
-        return seed;
-    }
-    };
-
     struct SynthesisResult{
         bool realizability;
         CUDD::BDD winning_states;
-        std::unique_ptr<Transducer> transducer;
+        LazyTransducer transducer;  // constructed when first accessed
     };
 
     /**
@@ -64,7 +55,7 @@ class Synthesizer {
    * \return The result consists of
    * realizability
    * a set of agent winning states
-   * a transducer representing a winning strategy for the specification or nullptr if the specification is unrealizable.
+   * a transducer representing a winning strategy for the specification, constructed when first accessed, or none if strategies are not synthesized.
    */
   virtual SynthesisResult run() = 0;
 };
@@ -0,0 +1,133 @@
+#ifndef TRACER_H
+#define TRACER_H
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "CuddStatistics.h"
+
+namespace Syft {
+
+/**
+ * \brief Records nested phases of a run as Chrome trace events.
+ *
+ * Phases are recorded by constructing a Tracer::Scope, which measures wall
+ * time and the CPU time of its thread in microseconds and the peak resident
+ * set size from its construction to its destruction, together with the
+ * statistics of a CUDD manager over the phase if one is given. Nested scopes
+ * show up as nested slices when the trace is opened in chrome://tracing or
+ * Perfetto. Tracing is process-wide and off until enabled, in which case
+ * scopes cost one check.
+ */
+class Tracer {
+ private:
+
+  using Clock = std::chrono::steady_clock;
+
+  struct Event {
+    std::string name;
+    std::string category;
+    std::string detail;
+    long long start_us;
+    long long duration_us;
+    long long cpu_us;
+    long peak_rss_kb;
+    std::thread::id thread_id;
+    // Small sequential number of the thread, since trace viewers read
+    // thread IDs as doubles
+    std::size_t thread;
+    std::vector<std::pair<std::string, double>> counters;
+  };
+
+  bool enabled_;
+  Clock::time_point origin_;
+  mutable std::mutex mutex_;
+  std::vector<Event> events_;
+  std::unordered_map<std::thread::id, std::size_t> thread_numbers_;
+
+  Tracer();
+
+  void record(Event event);
+
+ public:
+
+  /**
+   * \brief A phase, recorded from construction to destruction.
+   */
+  class Scope {
+   private:
+
+    bool active_;
+    std::string name_;
+    std::string category_;
+    std::string detail_;
+    Clock::time_point start_;
+    long long cpu_start_us_;
+    std::shared_ptr<CUDD::Cudd> cudd_mgr_;
+    CuddStatistics cudd_start_;
+
+   public:
+
+    /**
+     * \brief Starts a phase, if tracing is enabled.
+     *
+     * \param name The name of the phase.
+     * \param category The category of the phase, such as "dfa" or "game".
+     * \param detail Additional information shown with the phase, such as the
+     *   formula being translated.
+     */
+    Scope(std::string name, std::string category, std::string detail = "");
+
+    /**
+     * \brief Starts a phase that also records the statistics of a CUDD
+     *   manager over the phase, if tracing is enabled.
+     *
+     * \param name The name of the phase.
+     * \param category The category of the phase.
+     * \param cudd_mgr The manager whose statistics to record.
+     * \param detail Additional information shown with the phase.
+     */
+    Scope(std::string name, std::string category,
+          std::shared_ptr<CUDD::Cudd> cudd_mgr, std::string detail = "");
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+    /**
+     * \brief Ends the phase and records it.
+     */
+    ~Scope();
+  };
+
+  /**
+   * \brief Returns the tracer of the process.
+   */
+  static Tracer& instance();
+
+  /**
+   * \brief Starts recording phases.
+   */
+  void enable();
+
+  /**
+   * \brief Returns whether phases are recorded.
+   */
+  bool enabled() const;
+
+  /**
+   * \brief Writes the recorded phases in Chrome's trace-event JSON format.
+   *
+   * \param filename The file to write.
+   */
+  void write(const std::string& filename) const;
+};
+
+}
+
+#endif // TRACER_H
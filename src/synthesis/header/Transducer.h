@@ -44,11 +44,61 @@ class Transducer {
 
   std::unordered_map<int, CUDD::BDD> get_output_function() const;
 
+  /**
+   * \brief Returns the variable manager.
+   */
+  std::shared_ptr<VarMgr> var_mgr() const;
+
   /**
    * \brief Saves the output function of the transducer in a .dot file.
    */
   void dump_dot(const std::string& filename) const;
 
+  /**
+   * \brief Saves the transducer to a file.
+   *
+   * The output and transition functions are stored in DDDMP's binary format,
+   * after the variables of the variable manager, so that the strategy can be
+   * loaded in a separate process without running synthesis again.
+   *
+   * \param filename The name of the file to save the transducer to.
+   */
+  void save(const std::string& filename) const;
+
+  /**
+   * \brief Loads a transducer saved with \a save.
+   *
+   * \param filename The name of the file to load the transducer from.
+   * \return The transducer, with a new variable manager where every variable
+   *   has the same index and name as when the transducer was saved.
+   */
+  static Transducer load(const std::string& filename);
+
+  /**
+   * \brief Constructs a transducer that always picks a winning move.
+   *
+   * Solves the winning moves for the output variables, as functions of the
+   * state and input variables.
+   *
+   * \param var_mgr The variable manager of the game.
+   * \param initial_vector The initial state of the arena.
+   * \param winning_moves A BDD over state, input and output variables with the
+   *   moves the strategy may choose from.
+   * \param transition_function The transition function of the arena.
+   * \param starting_player The player that moves first each turn.
+   * \param protagonist_player The player the strategy is for.
+   * \param verify Whether to check that the output functions found implement
+   *   every winning move.
+   */
+  static std::unique_ptr<Transducer> from_winning_moves(
+      std::shared_ptr<VarMgr> var_mgr,
+      std::vector<int> initial_vector,
+      const CUDD::BDD& winning_moves,
+      std::vector<CUDD::BDD> transition_function,
+      Player starting_player,
+      Player protagonist_player,
+      bool verify = true);
+
 };
 
 }
@@ -1,6 +1,7 @@
 #ifndef VAR_MGR_H
 #define VAR_MGR_H
 
+#include <cstdio>
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -8,6 +9,41 @@
 #include "cuddObj.hh"
 
 namespace Syft {
+/**
+ * \brief Resources of the CUDD manager of a VarMgr.
+ *
+ * A default-constructed object keeps CUDD's defaults.
+ */
+struct CuddResources {
+  /// Initial number of slots in each subtable of the unique table, or 0 for
+  /// CUDD's default
+  unsigned int unique_slots = 0;
+  /// Initial number of slots in the computed table (cache), or 0 for CUDD's
+  /// default
+  unsigned int cache_slots = 0;
+  /// Maximum memory in bytes the manager may use, or 0 for no limit
+  std::size_t max_memory = 0;
+  /// Maximum number of slots the cache may grow to, or 0 for CUDD's default
+  unsigned int max_cache_hard = 0;
+  /// Number of nodes up to which the unique table grows without garbage
+  /// collection being tried first, or 0 for CUDD's default
+  unsigned int loose_up_to = 0;
+  /// Whether dead nodes are garbage collected
+  bool garbage_collection = true;
+
+  /**
+   * \brief Returns these resources with the initial unique table and cache
+   *   sized for the symbolic encoding of DFAs.
+   *
+   * Small DFAs get tables smaller than CUDD's defaults, large ones larger
+   * tables. Slot counts already set are kept.
+   *
+   * \param dfa_node_count The size of the DFAs, as given by
+   *   ExplicitStateDfaMona::node_count.
+   */
+  CuddResources fitted_to_dfas(std::size_t dfa_node_count) const;
+};
+
 /**
  * \brief A dictionary that maps variable names to indices and vice versa.
  */
@@ -16,20 +52,37 @@ class VarMgr {
   private:
 
   std::shared_ptr<CUDD::Cudd> mgr_;
+  CuddResources resources_;
   std::unordered_map<int, std::string> index_to_name_; // include only X, Y variables
   std::unordered_map<std::string, CUDD::BDD> name_to_variable_; 
   std::size_t state_variable_count_;    // number of Z variables
   std::vector<std::vector<CUDD::BDD>> state_variables_; // Z variables
   std::vector<CUDD::BDD> input_variables_;              // X variables
   std::vector<CUDD::BDD> output_variables_;             // Y variables
+  std::unordered_map<int, CUDD::BDD> next_state_variables_; // Z' variables, keyed by the index of the Z variable
   // std::size_t total_variable_count_;    // number of Z, X and Y variables
 
   public:
 
   /**
    * \brief Constructs a VarMgr with no variables.
+   *
+   * \param resources The resources of the CUDD manager.
    */
-  VarMgr();
+  VarMgr(const CuddResources& resources = CuddResources());
+
+  /**
+   * \brief Sizes the cache for the symbolic encoding of DFAs.
+   *
+   * Raises the limits up to which the cache and the unique table grow in
+   * proportion to the size of the DFAs, never lowering the current limits. The
+   * initial size of the tables is set on construction, see
+   * CuddResources::fitted_to_dfas.
+   *
+   * \param dfa_node_count The size of the DFAs, as given by
+   *   ExplicitStateDfaMona::node_count.
+   */
+  void fit_cache_to_dfas(std::size_t dfa_node_count);
 
   /**
    * \brief Prints information stored in VarMgr
@@ -99,6 +152,31 @@ class VarMgr {
    * \brief Returns the i-th state variable for a given automaton.
    */
   CUDD::BDD state_variable(std::size_t automaton_id, std::size_t i) const;
+
+  /**
+   * \brief Returns the state variables of a given automaton.
+   */
+  std::vector<CUDD::BDD> state_variables(std::size_t automaton_id) const;
+
+  /**
+   * \brief Creates next-state variables for the state variables of an automaton.
+   *
+   * Each next-state variable is placed right below its state variable in the
+   * variable ordering. State variables that already have a next-state copy,
+   * such as those shared with the components of a product automaton, keep it.
+   *
+   * \param automaton_id The ID of the automaton whose variables to copy.
+   */
+  void create_next_state_variables(std::size_t automaton_id);
+
+  /**
+   * \brief Returns the next-state variables of a given automaton.
+   *
+   * \return A vector whose i-th element is the next-state copy of the i-th
+   *   state variable of the automaton. The copies must have been created with
+   *   \a create_next_state_variables.
+   */
+  std::vector<CUDD::BDD> next_state_variables(std::size_t automaton_id) const;
   
   /**
    * \brief Converts a state vector to a BDD.
@@ -124,6 +202,61 @@ class VarMgr {
   void partition_variables(const std::vector<std::string>& input_names,
 			   const std::vector<std::string>& output_names);
 
+  /**
+   * \brief Returns the variable ordering.
+   *
+   * \return A vector whose i-th element is the index of the variable at level i.
+   */
+  std::vector<int> variable_order() const;
+
+  /**
+   * \brief Changes the variable ordering.
+   *
+   * Existing BDDs stay valid, but are rebuilt to follow the new ordering.
+   *
+   * \param order A vector whose i-th element is the index of the variable to
+   *   place at level i. It must be a permutation of all variable indices.
+   */
+  void set_variable_order(const std::vector<int>& order);
+
+  /**
+   * \brief Writes the variable ordering to a file, by variable label.
+   *
+   * Unlike \a save_variables, the ordering is identified by the labels of
+   * \a variable_labels, so it can be read by a manager created for a different
+   * problem.
+   *
+   * \param file A file open for writing.
+   */
+  void save_variable_order(FILE* file) const;
+
+  /**
+   * \brief Reads a variable ordering written by \a save_variable_order.
+   *
+   * Variables whose label was saved follow the saved ordering. Each other
+   * variable is placed right below the saved variable whose label differs
+   * from its own only in numbers, with the largest such numbers below its
+   * own, so that an ordering learned on an instance of a parametric family
+   * extends to larger instances. Variables with no such saved variable are
+   * placed at the bottom in their current relative order.
+   *
+   * \param file A file open for reading.
+   * \return A vector whose i-th element is the index of the variable to place
+   *   at level i, to be passed to \a set_variable_order.
+   */
+  std::vector<int> read_variable_order(FILE* file) const;
+
+  /**
+   * \brief Keeps the state variables of an automaton together in dynamic
+   *   reordering.
+   *
+   * The variables can still be reordered among themselves, but not separated.
+   *
+   * \param automaton_id The ID of the automaton whose variables to group. Its
+   *   variables must be at adjacent levels.
+   */
+  void group_state_variables(std::size_t automaton_id);
+
   /**
    * \brief Returns the CUDD manager used to create the variables.
    */
@@ -145,7 +278,8 @@ class VarMgr {
   std::string index_to_name(int index) const;
   
   /**
-   * \brief Returns the total number of variables, including named and state.
+   * \brief Returns the total number of variables, including named, state and
+   *   next-state.
    */
   std::size_t total_variable_count() const;
 
@@ -218,6 +352,8 @@ class VarMgr {
    *   index \a i. For named variables the label is the variable's name. For
    *   state variables the label is a representation that indicates which
    *   automaton the variable is from and which bit of the state it represents.
+   *   Next-state variables get the label of their state variable followed by
+   *   a prime.
    */
   std::vector<std::string> variable_labels() const;
 
@@ -288,6 +424,60 @@ class VarMgr {
     * \return an ID to be used later.
     */
     std::size_t copy_state_variables(std::size_t automaton_id);
+
+  /**
+   * \brief Writes the variables to a file.
+   *
+   * Records the named variables with their role, the state and next-state
+   * variables of every automaton and the variable ordering, so that
+   * \a load_variables can rebuild a manager where every variable has the same
+   * index.
+   *
+   * \param file A file open for writing.
+   */
+  void save_variables(FILE* file) const;
+
+  /**
+   * \brief Creates a variable manager from variables written by
+   *   \a save_variables.
+   *
+   * \param file A file open for reading, positioned where the variables start.
+   * \return A new manager with the same variables, automaton IDs and variable
+   *   ordering as the saved one.
+   */
+  static std::shared_ptr<VarMgr> load_variables(FILE* file);
+
+  /**
+   * \brief Creates a variable manager with the same variables on a new CUDD
+   *   manager.
+   *
+   * Every variable keeps its index, so BDDs can be moved between the two
+   * managers with CUDD::BDD::Transfer. The new CUDD manager has the same
+   * resources and the same time limit, but not the reordering settings or
+   * variable groups.
+   *
+   * \return A new manager with the same variables, automaton IDs and variable
+   *   ordering as this one.
+   */
+  std::shared_ptr<VarMgr> copy() const;
+
+  /**
+   * \brief Writes BDDs to a file in DDDMP's binary format.
+   *
+   * Variables are identified by their index.
+   *
+   * \param bdds The BDDs to write.
+   * \param file A file open for writing.
+   */
+  void save_bdds(const std::vector<CUDD::BDD>& bdds, FILE* file) const;
+
+  /**
+   * \brief Reads BDDs written by \a save_bdds.
+   *
+   * \param file A file open for reading, positioned where the BDDs start.
+   * \return The BDDs, in the order they were written.
+   */
+  std::vector<CUDD::BDD> load_bdds(FILE* file) const;
 };
 
 }
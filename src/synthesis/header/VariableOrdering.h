@@ -0,0 +1,89 @@
+#ifndef VARIABLE_ORDERING_H
+#define VARIABLE_ORDERING_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Player.h"
+#include "SynthesisOptions.h"
+#include "VarMgr.h"
+
+namespace Syft {
+
+/**
+ * \brief Computes and installs a variable ordering for the automata of a
+ *   synthesis problem.
+ *
+ * The automata are the ones whose state variables are created from DFAs,
+ * each with the propositions of the formula it was translated from. Products
+ * share the variables of their components and need not be added.
+ */
+class VariableOrdering {
+ private:
+
+  struct Automaton {
+    std::size_t automaton_id;
+    std::vector<std::string> propositions;
+  };
+
+  std::shared_ptr<VarMgr> var_mgr_;
+  Player starting_player_;
+  std::vector<Automaton> automata_;
+
+  std::vector<int> state_indices(const Automaton& automaton) const;
+
+  std::vector<int> named_indices(const std::vector<std::string>& names) const;
+
+  std::vector<int> order_propositions() const;
+
+ public:
+
+  /**
+   * \brief Constructs an ordering with no automata.
+   *
+   * \param var_mgr The manager of the variables to order.
+   * \param starting_player The player that moves first in the games.
+   */
+  VariableOrdering(std::shared_ptr<VarMgr> var_mgr, Player starting_player);
+
+  /**
+   * \brief Adds an automaton to the ordering.
+   *
+   * \param automaton_id The ID of the automaton in the variable manager.
+   * \param propositions The names of the propositions the automaton reads.
+   */
+  void add_automaton(std::size_t automaton_id,
+                     const std::vector<std::string>& propositions);
+
+  /**
+   * \brief Computes a variable ordering.
+   *
+   * Variables not covered by the ordering, such as next-state variables, are
+   * placed at the bottom in their current relative order.
+   *
+   * \return A vector whose i-th element is the index of the variable at level i.
+   */
+  std::vector<int> compute(VariableOrder order) const;
+
+  /**
+   * \brief Installs the variable ordering selected in the options.
+   *
+   * A variable ordering saved in a file takes precedence over the selected
+   * variable order.
+   *
+   * If requested, the variables are then reordered, starting from the
+   * installed ordering.
+   *
+   * \param options The options of the synthesizer, of which the variable order
+   *   and its file, whether to group automaton variables and whether to
+   *   reorder after the arena is constructed are used. Automata whose
+   *   variables are not at adjacent levels, as in an interleaved order, are
+   *   not grouped.
+   */
+  void apply(const SynthesisOptions& options) const;
+};
+
+}
+
+#endif // VARIABLE_ORDERING_H
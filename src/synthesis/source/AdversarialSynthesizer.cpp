@@ -5,6 +5,7 @@
 */
 
 #include "AdversarialSynthesizer.h"
+#include "VariableOrdering.h"
 #include <boost/algorithm/string.hpp>
 #include <queue>
 
@@ -15,38 +16,42 @@ namespace Syft {
                             std::string agent_specification,
                             std::string environment_specification,
                             InputOutputPartition partition,
-                            Player starting_player) :   
+                            Player starting_player,
+                            SynthesisOptions options) :   
                                 var_mgr_(var_mgr),
                                 agent_specification_(agent_specification),
                                 environment_specification_(environment_specification),
                                 partition_(partition),
-                                starting_player_(starting_player)
+                                starting_player_(starting_player),
+                                options_(options),
+                                reordering_clock_(var_mgr->cudd_mgr())
     {
 
         // step 1. Construct symbolic DFA of LTLf formula E -> Phi
         Stopwatch ltlf2dfa;
         ltlf2dfa.start();
 
-        std::string adversarial_formula = 
-            "(" + environment_specification_ + ") -> (" + agent_specification_ + ")";
-
-        ExplicitStateDfaMona adversarial_formula_dfa = 
-            ExplicitStateDfaMona::dfa_of_formula(adversarial_formula); 
-        
         // DFA A_{true} accepts non-empty traces only
-        ExplicitStateDfaMona tautology_dfa = 
-            ExplicitStateDfaMona::dfa_of_formula("F(true)");
+        std::vector<ExplicitStateDfaMona> formula_dfas =
+            ExplicitStateDfaMona::dfas_of_formulas(formulas(agent_specification_, environment_specification_, options_),
+                                                   options_.jobs,
+                                                   options_.dfa_cache_directory);
+        ExplicitStateDfaMona adversarial_formula_dfa = formula_dfas[0];
+        ExplicitStateDfaMona tautology_dfa = formula_dfas[1];
 
         // enforce non-empty trace semantics
         adversarial_formula_dfa = ExplicitStateDfaMona::dfa_product({adversarial_formula_dfa, tautology_dfa});
 
         double t_ltlf2dfa = ltlf2dfa.stop().count() / 1000.0;
-        running_times_.push_back(t_ltlf2dfa);
+        running_times_.push_back(reordering_clock_.exclude(t_ltlf2dfa));
         std::cout << "[BeSyft] LTLf-to-DFA construction DONE in: " << t_ltlf2dfa << " s" << std::endl;
 
         Syft::Stopwatch dfa2sym;
         dfa2sym.start();
 
+        if (options_.fit_cache_to_dfas)
+            var_mgr_->fit_cache_to_dfas(ExplicitStateDfaMona::node_count({adversarial_formula_dfa}));
+
         // formula parsed_adversarial_formula = 
             // parse_formula(adversarial_formula.c_str()); // parses (E -> phi)
 
@@ -60,11 +65,25 @@ namespace Syft {
         
         symbolic_dfa_.push_back(SymbolicStateDfa::from_explicit(std::move(explicit_adversarial_dfa)));
 
+        VariableOrdering variable_ordering(var_mgr_, starting_player_);
+        variable_ordering.add_automaton(symbolic_dfa_[0].automaton_id(), adversarial_formula_dfa.names);
+        variable_ordering.apply(options_);
+
         double t_dfa2sym = dfa2sym.stop().count() / 1000.0;
         std::cout << "[BeSyft] Symbolic DFA construction DONE in " << t_dfa2sym << std::endl;
-        running_times_.push_back(t_dfa2sym);
+        running_times_.push_back(reordering_clock_.exclude(t_dfa2sym));
+        problem_size_ = ProblemSize::of({adversarial_formula_dfa}, symbolic_dfa_[0]);
     }                        
 
+    std::vector<std::string> AdversarialSynthesizer::formulas(const std::string& agent_specification,
+                                                              const std::string& environment_specification,
+                                                              const SynthesisOptions& /*options*/) {
+        std::string adversarial_formula = 
+            "(" + environment_specification + ") -> (" + agent_specification + ")";
+
+        return {adversarial_formula, "F(true)"};
+    }
+
     SynthesisResult AdversarialSynthesizer::run() 
     {
         SynthesisResult adv_result;
@@ -78,15 +97,24 @@ namespace Syft {
                                                 starting_player_,
                                                 Player::Agent,
                                                 adv_goal, // Lifting
-                                                var_mgr_->cudd_mgr()->bddOne());
+                                                var_mgr_->cudd_mgr()->bddOne(),
+                                                options_.for_game("adversarial"));
         adv_result = adv_synthesizer.run();
         double t_advGame = advGame.stop().count() / 1000.0;
-        running_times_.push_back(t_advGame);
+        running_times_.push_back(reordering_clock_.exclude(t_advGame));
         std::cout << "DONE in " << t_advGame << " s" << std::endl;
         return adv_result;
     }
 
     std::vector<double> AdversarialSynthesizer::get_running_times() const {
-        return running_times_;
+        std::vector<double> running_times = running_times_;
+        if (reordering_enabled(options_)) {
+            running_times.push_back(reordering_clock_.total());
+        }
+        return running_times;
     }                                      
+
+    ProblemSize AdversarialSynthesizer::get_problem_size() const {
+        return problem_size_;
+    }
 }
\ No newline at end of file
@@ -0,0 +1,42 @@
+#include "BackgroundReachabilityGame.h"
+
+#include "Reordering.h"
+
+namespace Syft {
+
+BackgroundReachabilityGame::BackgroundReachabilityGame(
+    const SymbolicStateDfa& spec,
+    Player starting_player, Player protagonist_player,
+    const CUDD::BDD& goal_states,
+    const CUDD::BDD& state_space,
+    const SynthesisOptions& options)
+    : source_var_mgr_(spec.var_mgr())
+    , var_mgr_(spec.var_mgr()->copy())
+    , spec_(spec.transfer(var_mgr_))
+    , goal_states_(goal_states.Transfer(*var_mgr_->cudd_mgr()))
+    , state_space_(state_space.Transfer(*var_mgr_->cudd_mgr()))
+    , starting_player_(starting_player)
+    , protagonist_player_(protagonist_player)
+    , options_(options) {
+  configure_reordering(*var_mgr_->cudd_mgr(), options_);
+
+  winning_states_ = std::async(std::launch::async, [this]() {
+    ReachabilitySynthesizer synthesizer(spec_, starting_player_,
+                                        protagonist_player_, goal_states_,
+                                        state_space_, options_);
+    return synthesizer.run().winning_states;
+  });
+}
+
+BackgroundReachabilityGame::~BackgroundReachabilityGame() {
+  // The thread uses the members, which are destroyed after this
+  if (winning_states_.valid()) {
+    winning_states_.wait();
+  }
+}
+
+CUDD::BDD BackgroundReachabilityGame::winning_states() {
+  return winning_states_.get().Transfer(*source_var_mgr_->cudd_mgr());
+}
+
+}
@@ -11,20 +11,19 @@ namespace Syft {
 
     CoOperativeDfaGameSynthesizer::CoOperativeDfaGameSynthesizer(SymbolicStateDfa spec,
                                                                 Player starting_player,
-                                                                Player protagonist_player): 
+                                                                Player protagonist_player,
+                                                                SynthesisOptions options): 
                 Synthesizer<SymbolicStateDfa>(spec),
                 starting_player_(starting_player),
-                protagonist_player_(protagonist_player) {
+                protagonist_player_(protagonist_player),
+                options_(options) {
         var_mgr_ = spec.var_mgr(); // i.e. extract variabiles from SDFA
 
-        // Construct initial state and transition function of SDFA
-        initial_vector_ = var_mgr_->make_eval_vector(spec_.automaton_id(),
-                                                        spec_.initial_state());
-        transition_vector_ = var_mgr_->make_compose_vector(spec.automaton_id(),
-                                                            spec_.transition_function());
         // Get input and output variables
         CUDD::BDD input_cube = var_mgr_->input_cube();   // i.e. X
         CUDD::BDD output_cube = var_mgr_->output_cube(); // i.e. Y
+        // Variables existentially quantified by quantify_independent_variables_
+        CUDD::BDD independent_cube = var_mgr_->cudd_mgr()->bddOne();
 
         // quantify_independent_variables_ quantifies all variables
         // that the output function does not depend on
@@ -35,6 +34,7 @@ namespace Syft {
         if (starting_player_ == Player::Environment) {
             if (protagonist_player_ == Player::Environment) {
                 quantify_independent_variables_ = std::make_unique<Exists>(output_cube);
+                independent_cube = output_cube;
                 quantify_non_state_variables_ = std::make_unique<Exists>(input_cube);
             } else { // i.e. protagonist_player_ == Player::Agent
                 quantify_independent_variables_ = std::make_unique<NoQuantification>();
@@ -48,19 +48,52 @@ namespace Syft {
                                                                                 input_cube);
             } else { // i.e. protagonist_player_ == Player::Agent 
                 quantify_independent_variables_ = std::make_unique<Exists>(input_cube); // EXISTS X
+                independent_cube = input_cube;
                 quantify_non_state_variables_ = std::make_unique<Exists>(output_cube); // EXISTS X s.t. EXISTS Y
             }
         }
 
+        // Only existential quantifiers are used in the cooperative game, so
+        // the relational product can abstract the independent variables itself.
+        // Built before the vectors below, since it may create next-state
+        // variables that they need to account for
+        if (options_.preimage_engine == PreimageEngine::Relational) {
+            transition_relation_ = std::make_unique<PartitionedTransitionRelation>(spec_,
+                                                                                   options_.cluster_size,
+                                                                                   independent_cube);
+            quantify_independent_variables_ = std::make_unique<NoQuantification>();
+        }
+
+        // Construct initial state and transition function of SDFA
+        initial_vector_ = var_mgr_->make_eval_vector(spec_.automaton_id(),
+                                                        spec_.initial_state());
+        transition_vector_ = var_mgr_->make_compose_vector(spec.automaton_id(),
+                                                            spec_.transition_function());
+
+    }
+
+    CUDD::BDD CoOperativeDfaGameSynthesizer::transitions_into(
+        const CUDD::BDD &states) const {
+            if (transition_relation_) {
+                return transition_relation_->transitions_into(states);
+            }
+            return states.VectorCompose(transition_vector_);
     }
 
     CUDD::BDD CoOperativeDfaGameSynthesizer::preimage(
         const CUDD::BDD &winning_states) const {
-            CUDD::BDD winning_transitions =
-                winning_states.VectorCompose(transition_vector_);
+            CUDD::BDD winning_transitions = transitions_into(winning_states);
             return quantify_independent_variables_ -> apply(winning_transitions);
     }
 
+    CUDD::BDD CoOperativeDfaGameSynthesizer::frontier_preimage(
+        const CUDD::BDD &new_states, CUDD::BDD &winning_preimage) const {
+            // Both composition and existential quantification distribute over
+            // disjunction, so the preimage of the new states can be added on its own
+            winning_preimage |= preimage(new_states);
+            return winning_preimage;
+    }
+
     CUDD::BDD CoOperativeDfaGameSynthesizer::project_into_states(
         const CUDD::BDD& winning_moves) const {
             return quantify_non_state_variables_->apply(winning_moves);
@@ -71,59 +104,10 @@ namespace Syft {
         return winning_states.Eval(copy.data()).IsOne();
     }
 
-    std::unordered_map<int, CUDD::BDD> CoOperativeDfaGameSynthesizer::synthesize_strategy(
+    LazyTransducer CoOperativeDfaGameSynthesizer::synthesize_strategy(
         const CUDD::BDD &winning_moves) const {
-std::vector<CUDD::BDD> parameterized_output_function;
-  int* output_indices;
-  CUDD::BDD output_cube = var_mgr_->output_cube();
-  std::size_t output_count = var_mgr_->output_variable_count();
-
-  // Need to negate the BDD because b.SolveEqn(...) solves the equation b = 0
-  CUDD::BDD pre = (!winning_moves).SolveEqn(output_cube,
-					    parameterized_output_function,
-					    &output_indices,
-					    output_count);
-
-  // Copy the index since it will be necessary in the last step
-  std::vector<int> index_copy(output_count);
-
-  for (std::size_t i = 0; i < output_count; ++i) {
-    index_copy[i] = output_indices[i];
-  }
-
-  // Verify that the solution is correct, also frees output_index
-  CUDD::BDD verified = (!winning_moves).VerifySol(parameterized_output_function,
-						  output_indices);
-
-  assert(pre == verified);
-
-  std::unordered_map<int, CUDD::BDD> output_function;
-  
-  // Let y_i be the i-th output variable in the BDD ordering. The parameterized
-  // output function for y_i is of the form f_i(x_1, ..., x_m, p_i, ..., p_n)
-  // where p_i, ..., p_n are parameters taking the place of y_i, ..., y_n. All
-  // f_i are such that no matter what we replace p_i, ..., p_n with, the result
-  // is a valid output function. We replace the parameters with 1 so that all
-  // f_i are dependent only on the input and state variables.
-  for (int i = output_count - 1; i >= 0; --i) {
-      int output_index = index_copy[i];
-
-      output_function[output_index] = parameterized_output_function[i];
-
-      // TODO(Lucas): Replace inner loop with CUDD::BDD::VectorCompose
-      for (int j = output_count - 1; j >= i; --j) {
-          int parameter_index = index_copy[j];
-
-	  // Can be anything, set to the constant 1 for simplicity
-	  CUDD::BDD parameter_value = var_mgr_->cudd_mgr()->bddOne();
-
-	  output_function[output_index] =
-	    output_function[output_index].Compose(parameter_value,
-						  parameter_index);
-      }
-  }
-
-  return output_function;
-
-}
+        return LazyTransducer::for_winning_moves(spec_, initial_vector_, winning_moves,
+                                                 starting_player_, protagonist_player_,
+                                                 options_);
+    }
 }
\ No newline at end of file
@@ -1,36 +1,55 @@
 #include "CoOperativeReachabilitySynthesizer.h"
 #include <cassert>
 
+#include "FixpointTelemetry.h"
+#include "Reordering.h"
+#include "Tracer.h"
+
 namespace Syft {
 
 CoOperativeReachabilitySynthesizer::CoOperativeReachabilitySynthesizer(SymbolicStateDfa spec,
 						Player starting_player, Player protagonist_player,
 						 CUDD::BDD goal_states,
-						 CUDD::BDD state_space)
-    : CoOperativeDfaGameSynthesizer(spec, starting_player, protagonist_player)
+						 CUDD::BDD state_space,
+						 SynthesisOptions options)
+    : CoOperativeDfaGameSynthesizer(spec, starting_player, protagonist_player, options)
     , goal_states_(goal_states), state_space_(state_space)
 {}
 
 
 SynthesisResult CoOperativeReachabilitySynthesizer::run() {
+  Tracer::Scope trace("cooperative-reachability", "game",
+                      var_mgr_->cudd_mgr());
   SynthesisResult result;
   CUDD::BDD winning_states = state_space_ & goal_states_;
   CUDD::BDD winning_moves = winning_states;
+  // In frontier mode only the states won in the last iteration are composed
+  CUDD::BDD frontier = winning_states;
+  CUDD::BDD accumulated = var_mgr_->cudd_mgr()->bddZero();
+  std::size_t iteration = 0;
+  FixpointTelemetry telemetry(options_.telemetry_file,
+                              options_.telemetry_game.empty() ?
+                              "cooperative-reachability" : options_.telemetry_game,
+                              options_.telemetry_job, var_mgr_,
+                              spec_.automaton_id());
 
   while (true) {
+    telemetry.start_iteration();
+    CUDD::BDD winning_preimage = options_.frontier_preimage ?
+                                 frontier_preimage(frontier, accumulated) :
+                                 preimage(winning_states);
+
     CUDD::BDD new_winning_moves = winning_moves |
-                                  (state_space_ & (!winning_states) & preimage(winning_states));
+                                  (state_space_ & (!winning_states) & winning_preimage);
 
+    telemetry.start_projection();
     CUDD::BDD new_winning_states = project_into_states(new_winning_moves);
+    telemetry.end_iteration(new_winning_states, new_winning_moves);
 
     if (includes_initial_state(new_winning_states)) {
         result.realizability = true;
         result.winning_states = new_winning_states;
-        std::unordered_map<int, CUDD::BDD> strategy = synthesize_strategy(
-              new_winning_moves);
-        result.transducer = std::make_unique<Transducer>(
-              var_mgr_, initial_vector_, strategy, spec_.transition_function(),
-              starting_player_, protagonist_player_);
+        result.transducer = synthesize_strategy(new_winning_moves);
         winning_states_ = new_winning_states;
         winning_moves_ = new_winning_moves;
         return result;
@@ -38,18 +57,19 @@ SynthesisResult CoOperativeReachabilitySynthesizer::run() {
     } else if (new_winning_states == winning_states) {
         result.realizability = false;
         result.winning_states = new_winning_states;
-        // result.transducer = nullptr;
-        std::unordered_map<int, CUDD::BDD> strategy = synthesize_strategy(
-          new_winning_moves);
-        result.transducer = std::make_unique<Transducer>(
-              var_mgr_, initial_vector_, strategy, spec_.transition_function(),
-              starting_player_, protagonist_player_);
+        result.transducer = synthesize_strategy(new_winning_moves);
         winning_states_ = new_winning_states;
         winning_moves_ = new_winning_moves;
         return result;
     }
+    frontier = new_winning_states & !winning_states;
     winning_moves = new_winning_moves;
     winning_states = new_winning_states;
+
+    if (options_.reorder_interval > 0 &&
+        ++iteration % options_.reorder_interval == 0) {
+      reorder_variables(*var_mgr_->cudd_mgr(), options_);
+    }
   }
 
 }
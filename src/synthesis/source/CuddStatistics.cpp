@@ -0,0 +1,84 @@
+#include "CuddStatistics.h"
+
+#include <sstream>
+
+namespace Syft {
+
+CuddStatistics CuddStatistics::of(const CUDD::Cudd& mgr) {
+  CuddStatistics statistics;
+
+  statistics.peak_live_nodes = mgr.ReadPeakLiveNodeCount();
+  statistics.peak_nodes = mgr.ReadPeakNodeCount();
+  statistics.live_nodes = mgr.ReadNodeCount();
+  statistics.cache_lookups = mgr.ReadCacheLookUps();
+  statistics.cache_hits = mgr.ReadCacheHits();
+  statistics.garbage_collections = mgr.ReadGarbageCollections();
+  statistics.garbage_collection_time_ms = mgr.ReadGarbageCollectionTime();
+  statistics.reorderings = mgr.ReadReorderings();
+  statistics.reordering_time_ms = mgr.ReadReorderingTime();
+  statistics.memory_in_use = mgr.ReadMemoryInUse();
+
+  return statistics;
+}
+
+CuddStatistics CuddStatistics::since(const CuddStatistics& earlier) const {
+  CuddStatistics phase = *this;
+
+  phase.cache_lookups -= earlier.cache_lookups;
+  phase.cache_hits -= earlier.cache_hits;
+  phase.garbage_collections -= earlier.garbage_collections;
+  phase.garbage_collection_time_ms -= earlier.garbage_collection_time_ms;
+  phase.reorderings -= earlier.reorderings;
+  phase.reordering_time_ms -= earlier.reordering_time_ms;
+
+  return phase;
+}
+
+double CuddStatistics::cache_hit_rate() const {
+  return cache_lookups > 0 ? cache_hits / cache_lookups : 0.0;
+}
+
+std::vector<std::pair<std::string, double>> CuddStatistics::values() const {
+  return {{"peak_live_nodes", peak_live_nodes},
+          {"peak_nodes", peak_nodes},
+          {"live_nodes", live_nodes},
+          {"cache_lookups", cache_lookups},
+          {"cache_hits", cache_hits},
+          {"cache_hit_rate", cache_hit_rate()},
+          {"garbage_collections", garbage_collections},
+          {"garbage_collection_ms", garbage_collection_time_ms},
+          {"reorderings", reorderings},
+          {"reordering_ms", reordering_time_ms},
+          {"memory_in_use_bytes", (double) memory_in_use}};
+}
+
+std::string CuddStatistics::to_json() const {
+  std::ostringstream out;
+  out.precision(17);
+
+  out << "{";
+  bool first = true;
+  for (const auto& value : values()) {
+    out << (first ? "" : ",") << "\"" << value.first << "\":" << value.second;
+    first = false;
+  }
+  out << "}";
+
+  return out.str();
+}
+
+void CuddStatistics::print(std::ostream& out) const {
+  out << "[BeSyft] CUDD peak live nodes: " << peak_live_nodes << "\n"
+      << "[BeSyft] CUDD peak nodes allocated: " << peak_nodes << "\n"
+      << "[BeSyft] CUDD cache lookups: " << cache_lookups
+      << ", hits: " << cache_hits
+      << " (" << 100.0 * cache_hit_rate() << "%)\n"
+      << "[BeSyft] CUDD garbage collections: " << garbage_collections
+      << " (" << garbage_collection_time_ms << " ms)\n"
+      << "[BeSyft] CUDD reorderings: " << reorderings
+      << " (" << reordering_time_ms << " ms)\n"
+      << "[BeSyft] CUDD memory in use: " << memory_in_use << " bytes"
+      << std::endl;
+}
+
+}
@@ -0,0 +1,118 @@
+#include "DfaCache.h"
+
+#include <cctype>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <unistd.h>
+
+namespace Syft {
+
+namespace {
+// Identifies how formulas are translated. Changing the translation must
+// change this string, so that stale entries are no longer hit.
+const std::string translation_settings = "lydia-ltlf-to-ldlf-compositional-v1";
+}
+
+DfaCache::DfaCache(const std::string& directory) : directory_(directory) {}
+
+std::string DfaCache::default_directory() {
+  const char* xdg_cache_home = std::getenv("XDG_CACHE_HOME");
+  if (xdg_cache_home != nullptr && *xdg_cache_home != '\0') {
+    return (std::filesystem::path(xdg_cache_home) / "besyft").string();
+  }
+
+  const char* home = std::getenv("HOME");
+  if (home != nullptr && *home != '\0') {
+    return (std::filesystem::path(home) / ".cache" / "besyft").string();
+  }
+
+  return "";
+}
+
+std::string DfaCache::key(const std::string& formula) const {
+  // Collapses blanks, so that formulas differing only in layout share an entry
+  std::string normalized;
+  bool blank = false;
+  for (char c : formula) {
+    if (std::isspace(static_cast<unsigned char>(c))) {
+      blank = true;
+    } else {
+      if (blank && !normalized.empty()) normalized += ' ';
+      normalized += c;
+      blank = false;
+    }
+  }
+
+  return translation_settings + "\n" + normalized;
+}
+
+std::string DfaCache::entry_path(const std::string& key,
+                                 const std::string& extension) const {
+  // 64-bit FNV-1a, which unlike std::hash is stable across builds
+  std::uint64_t hash = 14695981039346656037ULL;
+  for (char c : key) {
+    hash ^= static_cast<unsigned char>(c);
+    hash *= 1099511628211ULL;
+  }
+
+  std::stringstream name;
+  name << std::hex << hash << extension;
+  return (std::filesystem::path(directory_) / name.str()).string();
+}
+
+std::optional<ExplicitStateDfaMona> DfaCache::load(
+    const std::string& formula) const {
+  std::string formula_key = key(formula);
+  std::string dfa_path = entry_path(formula_key, ".dfa");
+
+  // The key is stored next to the DFA to rule out hash collisions
+  std::ifstream key_file(entry_path(formula_key, ".key"));
+  if (!key_file || !std::filesystem::exists(dfa_path)) return std::nullopt;
+
+  std::stringstream stored_key;
+  stored_key << key_file.rdbuf();
+  if (stored_key.str() != formula_key) return std::nullopt;
+
+  try {
+    return ExplicitStateDfaMona::dfa_import(dfa_path);
+  } catch (const std::runtime_error&) {
+    return std::nullopt;
+  }
+}
+
+void DfaCache::store(const std::string& formula,
+                     const ExplicitStateDfaMona& dfa) const {
+  std::string formula_key = key(formula);
+  // Entries are written under a name private to this process and then
+  // renamed, so that concurrent runs never read a partial entry
+  std::string suffix = "." + std::to_string(getpid()) + ".tmp";
+  std::string dfa_path = entry_path(formula_key, ".dfa");
+  std::string key_path = entry_path(formula_key, ".key");
+
+  try {
+    std::filesystem::create_directories(directory_);
+
+    dfa.dfa_export(dfa_path + suffix);
+    std::filesystem::rename(dfa_path + suffix, dfa_path);
+
+    {
+      std::ofstream key_file(key_path + suffix);
+      key_file << formula_key;
+      if (!key_file) throw std::runtime_error("Error: could not write " + key_path + ".");
+    }
+    std::filesystem::rename(key_path + suffix, key_path);
+  } catch (const std::exception& e) {
+    std::error_code ignored;
+    std::filesystem::remove(dfa_path + suffix, ignored);
+    std::filesystem::remove(key_path + suffix, ignored);
+    std::cerr << "[BeSyft] Warning: could not store DFA in cache " << directory_
+              << ": " << e.what() << std::endl;
+  }
+}
+
+}
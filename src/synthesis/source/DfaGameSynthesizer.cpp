@@ -2,15 +2,28 @@
 
 #include <cassert>
 
+#include "Tracer.h"
+
 namespace Syft {
 
 DfaGameSynthesizer::DfaGameSynthesizer(SymbolicStateDfa spec,
 				       Player starting_player,
-                       Player protagonist_player)
+                       Player protagonist_player,
+                       SynthesisOptions options)
     : Synthesizer<SymbolicStateDfa>(spec)
     , starting_player_(starting_player)
-    , protagonist_player_(protagonist_player){
+    , protagonist_player_(protagonist_player)
+    , options_(options){
   var_mgr_ = spec_.var_mgr();
+
+  // Built first, since it may create next-state variables that the vectors
+  // below need to account for. Only next-state variables are abstracted in
+  // the relational product, since universal quantification of the
+  // independent variables cannot be interleaved with it.
+  if (options_.preimage_engine == PreimageEngine::Relational) {
+    transition_relation_ = std::make_unique<PartitionedTransitionRelation>(
+        spec_, options_.cluster_size, var_mgr_->cudd_mgr()->bddOne());
+  }
   
   // Make versions of the initial state and transition function that can be used
   // with CUDD::BDD::Eval and CUDD::BDD::VectorCompose, respectively
@@ -49,16 +62,34 @@ DfaGameSynthesizer::DfaGameSynthesizer(SymbolicStateDfa spec,
 
 }
 
+CUDD::BDD DfaGameSynthesizer::transitions_into(
+    const CUDD::BDD& states) const {
+  if (transition_relation_) {
+    return transition_relation_->transitions_into(states);
+  }
+
+  return states.VectorCompose(transition_vector_);
+}
+
 CUDD::BDD DfaGameSynthesizer::preimage(
     const CUDD::BDD& winning_states) const {
   // Transitions that move into a winning state
-  CUDD::BDD winning_transitions =
-    winning_states.VectorCompose(transition_vector_);
+  CUDD::BDD winning_transitions = transitions_into(winning_states);
 
   // Quantify all variables that the outputs don't depend on
   return quantify_independent_variables_->apply(winning_transitions);
 }
 
+CUDD::BDD DfaGameSynthesizer::frontier_preimage(
+    const CUDD::BDD& new_states, CUDD::BDD& composed_transitions) const {
+  // Composition distributes over disjunction, so the transitions into the old
+  // states need not be recomputed. Universal quantification does not, hence
+  // it is applied to the accumulated transitions rather than to the new ones.
+  composed_transitions |= transitions_into(new_states);
+
+  return quantify_independent_variables_->apply(composed_transitions);
+}
+
 CUDD::BDD DfaGameSynthesizer::project_into_states(
     const CUDD::BDD& winning_moves) const {
   return quantify_non_state_variables_->apply(winning_moves);
@@ -73,59 +104,11 @@ bool DfaGameSynthesizer::includes_initial_state(
   return winning_states.Eval(copy.data()).IsOne();
 }
 
-std::unordered_map<int, CUDD::BDD> DfaGameSynthesizer::synthesize_strategy(
+LazyTransducer DfaGameSynthesizer::synthesize_strategy(
     const CUDD::BDD& winning_moves) const {
-  std::vector<CUDD::BDD> parameterized_output_function;
-  int* output_indices;
-  CUDD::BDD output_cube = var_mgr_->output_cube();
-  std::size_t output_count = var_mgr_->output_variable_count();
-
-  // Need to negate the BDD because b.SolveEqn(...) solves the equation b = 0
-  CUDD::BDD pre = (!winning_moves).SolveEqn(output_cube,
-					    parameterized_output_function,
-					    &output_indices,
-					    output_count);
-
-  // Copy the index since it will be necessary in the last step
-  std::vector<int> index_copy(output_count);
-
-  for (std::size_t i = 0; i < output_count; ++i) {
-    index_copy[i] = output_indices[i];
-  }
-
-  // Verify that the solution is correct, also frees output_index
-  CUDD::BDD verified = (!winning_moves).VerifySol(parameterized_output_function,
-						  output_indices);
-
-  assert(pre == verified);
-
-  std::unordered_map<int, CUDD::BDD> output_function;
-  
-  // Let y_i be the i-th output variable in the BDD ordering. The parameterized
-  // output function for y_i is of the form f_i(x_1, ..., x_m, p_i, ..., p_n)
-  // where p_i, ..., p_n are parameters taking the place of y_i, ..., y_n. All
-  // f_i are such that no matter what we replace p_i, ..., p_n with, the result
-  // is a valid output function. We replace the parameters with 1 so that all
-  // f_i are dependent only on the input and state variables.
-  for (int i = output_count - 1; i >= 0; --i) {
-      int output_index = index_copy[i];
-
-      output_function[output_index] = parameterized_output_function[i];
-
-      // TODO(Lucas): Replace inner loop with CUDD::BDD::VectorCompose
-      for (int j = output_count - 1; j >= i; --j) {
-          int parameter_index = index_copy[j];
-
-	  // Can be anything, set to the constant 1 for simplicity
-	  CUDD::BDD parameter_value = var_mgr_->cudd_mgr()->bddOne();
-
-	  output_function[output_index] =
-	    output_function[output_index].Compose(parameter_value,
-						  parameter_index);
-      }
-  }
-
-  return output_function;
+  return LazyTransducer::for_winning_moves(spec_, initial_vector_, winning_moves,
+                                           starting_player_, protagonist_player_,
+                                           options_);
 }
 
 }
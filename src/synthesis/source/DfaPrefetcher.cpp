@@ -0,0 +1,109 @@
+#include "DfaPrefetcher.h"
+
+#include <csignal>
+#include <cstdio>
+#include <filesystem>
+#include <iostream>
+#include <unordered_map>
+#include <fcntl.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "ExplicitStateDfaMona.h"
+
+namespace Syft {
+
+DfaPrefetcher::DfaPrefetcher(const std::vector<std::string>& formulas,
+                             const std::string& cache_directory) {
+  for (const std::string& formula : formulas) {
+    if (!ExplicitStateDfaMona::has_memoized_dfa(formula)) {
+      formulas_.push_back(formula);
+    }
+  }
+  if (formulas_.empty()) return;
+
+  std::string dir_template =
+      (std::filesystem::temp_directory_path() / "besyft-prefetch-XXXXXX").string();
+  if (mkdtemp(dir_template.data()) == nullptr) {
+    formulas_.clear();
+    return;
+  }
+  directory_ = dir_template;
+
+  // Buffered output would otherwise be printed by both processes
+  std::cout.flush();
+  std::fflush(stdout);
+
+  worker_ = fork();
+  if (worker_ < 0) {
+    formulas_.clear();
+    return;
+  }
+
+  if (worker_ == 0) {
+    // The worker runs alongside the job of the calling process, whose output
+    // it must not interleave with
+    int null_output = open("/dev/null", O_WRONLY);
+    if (null_output >= 0) dup2(null_output, STDOUT_FILENO);
+
+    int status = 0;
+    for (std::size_t i = 0; i < formulas_.size(); ++i) {
+      try {
+        // Only complete files are renamed to their final name
+        std::filesystem::path filename =
+            std::filesystem::path(directory_) / (std::to_string(i) + ".dfa");
+        std::filesystem::path partial_filename = filename.string() + ".part";
+        ExplicitStateDfaMona::dfa_of_formula(formulas_[i], cache_directory)
+            .dfa_export(partial_filename.string());
+        std::filesystem::rename(partial_filename, filename);
+      } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        status = 1;
+      }
+    }
+    _exit(status);
+  }
+}
+
+DfaPrefetcher::~DfaPrefetcher() {
+  stop();
+}
+
+void DfaPrefetcher::stop() {
+  if (worker_ > 0) {
+    kill(worker_, SIGKILL);
+    waitpid(worker_, nullptr, 0);
+    worker_ = -1;
+  }
+  if (!directory_.empty()) {
+    std::error_code error;
+    std::filesystem::remove_all(directory_, error);
+    directory_.clear();
+  }
+}
+
+void DfaPrefetcher::collect() {
+  if (worker_ > 0) {
+    // A worker that failed may still have translated some of the formulas
+    waitpid(worker_, nullptr, 0);
+    worker_ = -1;
+
+    std::unordered_map<std::string, ExplicitStateDfaMona> dfas;
+    for (std::size_t i = 0; i < formulas_.size(); ++i) {
+      std::filesystem::path filename =
+          std::filesystem::path(directory_) / (std::to_string(i) + ".dfa");
+      if (!std::filesystem::exists(filename)) continue;
+      try {
+        dfas.emplace(formulas_[i],
+                     ExplicitStateDfaMona::dfa_import(filename.string()));
+      } catch (const std::exception&) {
+        // The job translates the formula itself
+      }
+    }
+    ExplicitStateDfaMona::provide_dfas(std::move(dfas));
+  }
+
+  stop();
+}
+
+}
@@ -0,0 +1,345 @@
+#include "DominanceChecker.h"
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include "PackedState.h"
+#include "PartitionedTransitionRelation.h"
+#include "Tracer.h"
+
+namespace Syft {
+
+namespace {
+
+// The arena under the cooperative strategy, evaluated on packed states with
+// Cudd_Eval, which only reads the manager. Copies share the BDDs but not the
+// assignments, so each thread evaluates on its own copy. No BDD is created or
+// referenced after construction.
+template <std::size_t Words>
+class ExplicitArena {
+ private:
+
+  DdManager* dd_;
+  DdNode* one_;
+  DdNode* witnesses_;
+  DdNode* cooperative_only_states_;
+  std::vector<DdNode*> transition_function_;
+  std::vector<int> state_indices_;
+  std::vector<int> input_indices_;
+  // Holds the current state and input
+  std::vector<int> assignment_;
+  // Holds a successor, to test whether it is cooperative-only
+  std::vector<int> probe_;
+
+  bool holds(DdNode* f, std::vector<int>& values) const {
+    return Cudd_Eval(dd_, f, values.data()) == one_;
+  }
+
+ public:
+
+  ExplicitArena(const SymbolicStateDfa& arena,
+                const CUDD::BDD& witnesses,
+                const CUDD::BDD& cooperative_only_states,
+                const std::vector<CUDD::BDD>& transition_function)
+      : dd_(arena.var_mgr()->cudd_mgr()->getManager())
+      , one_(Cudd_ReadOne(dd_))
+      , witnesses_(witnesses.getNode())
+      , cooperative_only_states_(cooperative_only_states.getNode()) {
+    std::shared_ptr<VarMgr> var_mgr = arena.var_mgr();
+
+    for (const CUDD::BDD& bit : transition_function) {
+      transition_function_.push_back(bit.getNode());
+    }
+
+    for (const CUDD::BDD& variable :
+           var_mgr->state_variables(arena.automaton_id())) {
+      state_indices_.push_back(variable.NodeReadIndex());
+    }
+
+    for (const std::string& label : var_mgr->input_variable_labels()) {
+      input_indices_.push_back(
+          var_mgr->name_to_variable(label).NodeReadIndex());
+    }
+
+    assignment_.assign(var_mgr->cudd_mgr()->ReadSize(), 0);
+    probe_.assign(assignment_.size(), 0);
+  }
+
+  std::uint64_t input_count() const {
+    return std::uint64_t(1) << input_indices_.size();
+  }
+
+  // Makes state the current state, returning whether it is a witness
+  bool enter(const PackedState<Words>& state) {
+    for (std::size_t i = 0; i < state_indices_.size(); ++i) {
+      assignment_[state_indices_[i]] = state.get(i);
+    }
+
+    return holds(witnesses_, assignment_);
+  }
+
+  // Computes the successor of the current state on an input, returning
+  // whether it is cooperative-only
+  bool successor(std::uint64_t input, PackedState<Words>& successor) {
+    for (std::size_t i = 0; i < input_indices_.size(); ++i) {
+      assignment_[input_indices_[i]] = (input >> i) & 1;
+    }
+
+    for (std::size_t i = 0; i < state_indices_.size(); ++i) {
+      bool bit = holds(transition_function_[i], assignment_);
+      successor.set(i, bit);
+      probe_[state_indices_[i]] = bit;
+    }
+
+    return holds(cooperative_only_states_, probe_);
+  }
+};
+
+template <std::size_t Words>
+bool reaches_sequentially(ExplicitArena<Words> arena,
+                          const PackedState<Words>& initial_state) {
+  PackedStateSet<Words> reached;
+  reached.insert(initial_state);
+  std::vector<PackedState<Words>> frontier = {initial_state};
+  std::vector<PackedState<Words>> next_frontier;
+  PackedState<Words> successor;
+
+  while (!frontier.empty()) {
+    next_frontier.clear();
+
+    for (const PackedState<Words>& state : frontier) {
+      if (arena.enter(state)) {
+        return true;
+      }
+
+      // Only successors in the cooperative-only region are explored further
+      for (std::uint64_t input = 0; input < arena.input_count(); ++input) {
+        if (arena.successor(input, successor) && reached.insert(successor)) {
+          next_frontier.push_back(successor);
+        }
+      }
+    }
+
+    std::swap(frontier, next_frontier);
+  }
+
+  return false;
+}
+
+template <std::size_t Words>
+struct WorkQueue {
+  std::mutex mutex;
+  std::deque<PackedState<Words>> states;
+};
+
+// Explores the arena depth-first with one queue per thread. A thread takes
+// states from the back of its own queue and, once it is empty, steals from
+// the front of the others. Reachability does not depend on the order in which
+// states are expanded, so there is no synchronization between levels.
+template <std::size_t Words>
+bool reaches_in_parallel(const ExplicitArena<Words>& arena,
+                         const PackedState<Words>& initial_state,
+                         std::size_t thread_count) {
+  ConcurrentPackedStateSet<Words> reached(16 * thread_count);
+  std::vector<WorkQueue<Words>> queues(thread_count);
+  std::atomic<bool> found(false);
+  // States added to the queues and not yet fully expanded
+  std::atomic<std::size_t> pending(1);
+
+  reached.insert(initial_state);
+  queues[0].states.push_back(initial_state);
+
+  auto take = [&](std::size_t id, PackedState<Words>& state) {
+    for (std::size_t k = 0; k < thread_count; ++k) {
+      std::size_t victim = (id + k) % thread_count;
+      std::lock_guard<std::mutex> lock(queues[victim].mutex);
+      std::deque<PackedState<Words>>& states = queues[victim].states;
+
+      if (states.empty()) continue;
+
+      if (victim == id) {
+        state = states.back();
+        states.pop_back();
+      } else {
+        state = states.front();
+        states.pop_front();
+      }
+      return true;
+    }
+    return false;
+  };
+
+  auto work = [&](std::size_t id) {
+    ExplicitArena<Words> local_arena = arena;
+    PackedState<Words> state;
+    PackedState<Words> successor;
+
+    while (!found.load(std::memory_order_relaxed)) {
+      if (!take(id, state)) {
+        if (pending.load() == 0) return;
+        std::this_thread::yield();
+        continue;
+      }
+
+      if (local_arena.enter(state)) {
+        found = true;
+        return;
+      }
+
+      for (std::uint64_t input = 0;
+           input < local_arena.input_count() &&
+             !found.load(std::memory_order_relaxed);
+           ++input) {
+        if (local_arena.successor(input, successor) &&
+            reached.insert(successor)) {
+          ++pending;
+          std::lock_guard<std::mutex> lock(queues[id].mutex);
+          queues[id].states.push_back(successor);
+        }
+      }
+
+      --pending;
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (std::size_t id = 1; id < thread_count; ++id) {
+    threads.emplace_back(work, id);
+  }
+  work(0);
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  return found;
+}
+
+}
+
+DominanceChecker::DominanceChecker(const SymbolicStateDfa& arena,
+                                   SynthesisOptions options)
+    : arena_(arena)
+    , options_(std::move(options))
+{}
+
+bool DominanceChecker::is_dominant(
+    const BestEffortSynthesisResult& best_effort_result,
+    const CUDD::BDD& cooperative_moves) const {
+  Tracer::Scope trace("is_dominant", "dominance", arena_.var_mgr()->cudd_mgr());
+
+  std::shared_ptr<VarMgr> var_mgr = arena_.var_mgr();
+  CUDD::BDD output_cube = var_mgr->output_cube();
+
+  // A state is a witness if, for some input, the agent has a cooperative move
+  // other than the one picked by the compatible projection
+  CUDD::BDD witnesses =
+    (cooperative_moves * !cooperative_moves.CProjection(output_cube))
+    .ExistAbstract(var_mgr->input_cube() * output_cube);
+
+  CUDD::BDD cooperative_only_states =
+    best_effort_result.cooperative.winning_states *
+    !best_effort_result.adversarial.winning_states;
+
+  std::vector<CUDD::BDD> transition_function =
+    strategy_transition_function(best_effort_result);
+
+  if (options_.dominance_engine == DominanceEngine::Explicit &&
+      var_mgr->input_variable_count() <= 62) {
+    std::size_t state_variable_count =
+      var_mgr->state_variable_count(arena_.automaton_id());
+
+    if (state_variable_count <= 64) {
+      return !reaches_explicitly<1>(witnesses, cooperative_only_states,
+                                    transition_function);
+    } else if (state_variable_count <= 128) {
+      return !reaches_explicitly<2>(witnesses, cooperative_only_states,
+                                    transition_function);
+    } else if (state_variable_count <= 256) {
+      return !reaches_explicitly<4>(witnesses, cooperative_only_states,
+                                    transition_function);
+    } else if (state_variable_count <= 512) {
+      return !reaches_explicitly<8>(witnesses, cooperative_only_states,
+                                    transition_function);
+    }
+  }
+
+  return !reaches_symbolically(witnesses, cooperative_only_states,
+                               transition_function);
+}
+
+std::vector<CUDD::BDD> DominanceChecker::strategy_transition_function(
+    const BestEffortSynthesisResult& best_effort_result) const {
+  std::shared_ptr<CUDD::Cudd> mgr = arena_.var_mgr()->cudd_mgr();
+
+  // Fixes the outputs of the transition function to the cooperative strategy
+  std::vector<CUDD::BDD> substitution;
+  substitution.reserve(mgr->ReadSize());
+  for (int i = 0; i < mgr->ReadSize(); ++i) {
+    substitution.push_back(mgr->bddVar(i));
+  }
+  for (const auto& index_and_function :
+         best_effort_result.cooperative.transducer->get_output_function()) {
+    substitution[index_and_function.first] = index_and_function.second;
+  }
+
+  std::vector<CUDD::BDD> transition_function;
+  for (const CUDD::BDD& bit : arena_.transition_function()) {
+    transition_function.push_back(bit.VectorCompose(substitution));
+  }
+
+  return transition_function;
+}
+
+bool DominanceChecker::reaches_symbolically(
+    const CUDD::BDD& witnesses,
+    const CUDD::BDD& cooperative_only_states,
+    const std::vector<CUDD::BDD>& transition_function) const {
+  PartitionedTransitionRelation transition_relation =
+    PartitionedTransitionRelation::forward(arena_,
+                                           transition_function,
+                                           options_.cluster_size,
+                                           arena_.var_mgr()->input_cube());
+
+  CUDD::BDD reached = arena_.initial_state_bdd();
+  CUDD::BDD frontier = reached;
+
+  while (!frontier.IsZero()) {
+    if (!(frontier * witnesses).IsZero()) {
+      return true;
+    }
+
+    // Only successors in the cooperative-only region are explored further
+    CUDD::BDD successors =
+      transition_relation.image(frontier) * cooperative_only_states;
+    frontier = successors * !reached;
+    reached |= frontier;
+  }
+
+  return false;
+}
+
+template <std::size_t Words>
+bool DominanceChecker::reaches_explicitly(
+    const CUDD::BDD& witnesses,
+    const CUDD::BDD& cooperative_only_states,
+    const std::vector<CUDD::BDD>& transition_function) const {
+  ExplicitArena<Words> arena(arena_, witnesses, cooperative_only_states,
+                             transition_function);
+
+  PackedState<Words> initial_state;
+  std::vector<int> initial_bits = arena_.initial_state();
+  for (std::size_t i = 0; i < initial_bits.size(); ++i) {
+    initial_state.set(i, initial_bits[i] != 0);
+  }
+
+  if (options_.jobs <= 1) {
+    return reaches_sequentially(arena, initial_state);
+  } else {
+    return reaches_in_parallel(arena, initial_state, options_.jobs);
+  }
+}
+
+}
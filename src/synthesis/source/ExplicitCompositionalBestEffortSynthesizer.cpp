@@ -4,6 +4,7 @@
 */
 
 #include "ExplicitCompositionalBestEffortSynthesizer.h"
+#include "VariableOrdering.h"
 #include <boost/algorithm/string.hpp>
 #include <queue>
 
@@ -15,12 +16,15 @@ namespace Syft {
                                                 std::string environment_specification,
                                                 InputOutputPartition partition,
                                                 Player starting_player,
-                                                bool dominance_check) :   var_mgr_(var_mgr),
+                                                bool dominance_check,
+                                                SynthesisOptions options) :   var_mgr_(var_mgr),
                                                                             agent_specification_(agent_specification),
                                                                             environment_specification_(environment_specification),
                                                                             partition_(partition),
                                                                             starting_player_(starting_player),
-                                                                            dominance_check_(dominance_check) 
+                                                                            dominance_check_(dominance_check),
+                                                                            options_(options),
+                                                                            reordering_clock_(var_mgr->cudd_mgr())
     {
         // step 1. Construct symbolic DFAs of formulas {E -> phi, !E, E /\ phi}
         // Build MONA DFAs for agent and environment specifications
@@ -31,12 +35,27 @@ namespace Syft {
         std::string adversarial_formula = 
             "(" + environment_specification + ") -> (" + agent_specification +")"; 
 
-        ExplicitStateDfaMona agent_spec_dfa =
-            ExplicitStateDfaMona::dfa_of_formula(agent_specification); // DFA A_{phi}
-        ExplicitStateDfaMona environment_spec_dfa =
-            ExplicitStateDfaMona::dfa_of_formula(environment_specification); // DFA A_{E}
-        ExplicitStateDfaMona no_empty_dfa = 
-            ExplicitStateDfaMona::dfa_of_formula("F(true)"); // DFA A_{tt}, i.e. accepts all non-empty traces
+        // If requested, each top-level conjunct gets its own DFA
+        std::pair<std::vector<std::string>, std::vector<std::string>> conjuncts =
+            split_specifications(agent_specification, environment_specification, options_.split_conjunctions);
+        const std::vector<std::string>& agent_conjuncts = conjuncts.first;
+
+        std::vector<ExplicitStateDfaMona> formula_dfas =
+            ExplicitStateDfaMona::dfas_of_formulas(formulas(conjuncts),
+                                                   options_.jobs,
+                                                   options_.dfa_cache_directory);
+
+        // The DFA of a conjunction is the product of the DFAs of its conjuncts
+        std::vector<ExplicitStateDfaMona> agent_conjunct_dfas(formula_dfas.begin(),
+                                                              formula_dfas.begin() + agent_conjuncts.size());
+        std::vector<ExplicitStateDfaMona> environment_conjunct_dfas(formula_dfas.begin() + agent_conjuncts.size(),
+                                                                    formula_dfas.end() - 1);
+
+        ExplicitStateDfaMona agent_spec_dfa = agent_conjunct_dfas.size() == 1 ? agent_conjunct_dfas[0] :
+            ExplicitStateDfaMona::dfa_product(agent_conjunct_dfas, options_.jobs); // DFA A_{phi}
+        ExplicitStateDfaMona environment_spec_dfa = environment_conjunct_dfas.size() == 1 ? environment_conjunct_dfas[0] :
+            ExplicitStateDfaMona::dfa_product(environment_conjunct_dfas, options_.jobs); // DFA A_{E}
+        ExplicitStateDfaMona no_empty_dfa = formula_dfas.back(); // DFA A_{tt}, i.e. accepts all non-empty traces
 
         // constructs DFA A_{E -> Phi}
         // a. Build DFA for implication (E -> phi) as !(E && (!phi))
@@ -45,21 +64,21 @@ namespace Syft {
         implication_dfas.push_back(ExplicitStateDfaMona::dfa_negation(agent_spec_dfa));
         implication_dfas.push_back(no_empty_dfa);
 
-        ExplicitStateDfaMona implication = ExplicitStateDfaMona::dfa_negation(ExplicitStateDfaMona::dfa_product(implication_dfas));
+        ExplicitStateDfaMona implication = ExplicitStateDfaMona::dfa_negation(ExplicitStateDfaMona::dfa_product(implication_dfas, options_.jobs));
 
         // b. Apply non-empty traces semantics
         std::vector<ExplicitStateDfaMona> adv_dfas;
         adv_dfas.push_back(implication);
         adv_dfas.push_back(no_empty_dfa);
 
-        ExplicitStateDfaMona adversarial_dfa = ExplicitStateDfaMona::dfa_product(adv_dfas);
+        ExplicitStateDfaMona adversarial_dfa = ExplicitStateDfaMona::dfa_product(adv_dfas, options_.jobs);
 
         // constructs DFA A_{!E}
         std::vector<ExplicitStateDfaMona> neg_dfas;
         neg_dfas.push_back(ExplicitStateDfaMona::dfa_negation(environment_spec_dfa));
         neg_dfas.push_back(no_empty_dfa); // i.e. apply non-empty traces semantics
 
-        ExplicitStateDfaMona negated_env_dfa = ExplicitStateDfaMona::dfa_product(neg_dfas);
+        ExplicitStateDfaMona negated_env_dfa = ExplicitStateDfaMona::dfa_product(neg_dfas, options_.jobs);
 
         // construts DFA A_{E /\ Phi}
         std::vector<ExplicitStateDfaMona> coop_dfas; 
@@ -67,15 +86,18 @@ namespace Syft {
         coop_dfas.push_back(agent_spec_dfa);
         coop_dfas.push_back(no_empty_dfa); // i.e. apply non-empty traces semantics
 
-        ExplicitStateDfaMona cooperative_dfa = ExplicitStateDfaMona::dfa_product(coop_dfas);
+        ExplicitStateDfaMona cooperative_dfa = ExplicitStateDfaMona::dfa_product(coop_dfas, options_.jobs);
 
         double t_ltlf2dfa = ltlf2dfa.stop().count() / 1000.0;
-        running_times_.push_back(t_ltlf2dfa);
+        running_times_.push_back(reordering_clock_.exclude(t_ltlf2dfa));
         std::cout << "[BeSyft] LTLf-to-DFA construction DONE in: " << t_ltlf2dfa << " s" << std::endl;
 
         Syft::Stopwatch dfa2sym;
         dfa2sym.start();
 
+        if (options_.fit_cache_to_dfas)
+            var_mgr_->fit_cache_to_dfas(ExplicitStateDfaMona::node_count({adversarial_dfa, negated_env_dfa, cooperative_dfa}));
+
         // formula parsed_adversarial_formula = 
             // parse_formula(adversarial_formula.c_str()); // parses (E -> phi)
 
@@ -112,12 +134,35 @@ namespace Syft {
             SymbolicStateDfa::product(symbolic_dfas_);
         arena_.push_back(arena);
 
+        VariableOrdering variable_ordering(var_mgr_, starting_player_);
+        variable_ordering.add_automaton(symbolic_adversarial_dfa.automaton_id(), adversarial_dfa.names);
+        variable_ordering.add_automaton(symbolic_negated_environment_dfa.automaton_id(), negated_env_dfa.names);
+        variable_ordering.add_automaton(symbolic_co_operative_dfa.automaton_id(), cooperative_dfa.names);
+        variable_ordering.apply(options_);
+
         double t_dfa2sym = dfa2sym.stop().count() / 1000.0;
-        running_times_.push_back(t_dfa2sym);
+        running_times_.push_back(reordering_clock_.exclude(t_dfa2sym));
         std::cout << "[BeSyft] Symbolic DFA construction DONE in " << t_dfa2sym << std::endl;
+        problem_size_ = ProblemSize::of({adversarial_dfa, negated_env_dfa, cooperative_dfa}, arena_[0]);
 
     }
 
+    std::vector<std::string> ExplicitCompositionalBestEffortSynthesizer::formulas(const std::string& agent_specification,
+            const std::string& environment_specification,
+            const SynthesisOptions& options) {
+        // If requested, each top-level conjunct gets its own DFA
+        return formulas(split_specifications(agent_specification, environment_specification,
+                                             options.split_conjunctions));
+    }
+
+    std::vector<std::string> ExplicitCompositionalBestEffortSynthesizer::formulas(
+            const std::pair<std::vector<std::string>, std::vector<std::string>>& conjuncts) {
+        std::vector<std::string> conjunct_formulas = conjuncts.first;
+        conjunct_formulas.insert(conjunct_formulas.end(), conjuncts.second.begin(), conjuncts.second.end());
+        conjunct_formulas.push_back("F(true)");
+        return conjunct_formulas;
+    }
+
     BestEffortSynthesisResult ExplicitCompositionalBestEffortSynthesizer::run() {
 
         BestEffortSynthesisResult best_effort_result;
@@ -126,6 +171,17 @@ namespace Syft {
         CUDD::BDD neg_goal = symbolic_dfas_[1].final_states();
         CUDD::BDD coop_goal = symbolic_dfas_[2].final_states();
 
+        // If requested, the game of step 4 is solved on another thread while the
+        // adversarial game is solved
+        std::unique_ptr<BackgroundReachabilityGame> neg_env_game;
+        if (options_.concurrent_games)
+            neg_env_game = std::make_unique<BackgroundReachabilityGame>(arena_[0],
+                                                                        starting_player_,
+                                                                        Player::Agent,
+                                                                        neg_goal,
+                                                                        var_mgr_->cudd_mgr()->bddOne(),
+                                                                        options_.for_game("negated-environment"));
+
         // Step 3. Compute a winning strategy in the adversarial game
         Stopwatch advGame;
         advGame.start();
@@ -134,23 +190,30 @@ namespace Syft {
                                                 starting_player_,
                                                 Player::Agent,
                                                 adv_goal, // Lifting
-                                                var_mgr_->cudd_mgr()->bddOne());
+                                                var_mgr_->cudd_mgr()->bddOne(),
+                                                options_.for_game("adversarial"));
         best_effort_result.adversarial = adv_synthesizer.run();
         double t_advGame = advGame.stop().count() / 1000.0;
-        running_times_.push_back(t_advGame);
+        running_times_.push_back(reordering_clock_.exclude(t_advGame));
         std::cout << "DONE in " << t_advGame << " s" << std::endl;
 
         // Step 4. Compute environment's winning region in negation of environment game
         Stopwatch coopGame;
         coopGame.start();
         std::cout << "[BeSyft] Constructing and solving cooperative game...";
-        ReachabilitySynthesizer neg_env_synthesizer(arena_[0],
-                                                    starting_player_,
-                                                    Player::Agent,  // gets env winning region from agent's
-                                                    neg_goal, // Lifting
-                                                    var_mgr_->cudd_mgr()->bddOne());
-        SynthesisResult env_result = neg_env_synthesizer.run();
-        CUDD::BDD non_environment_winning_region = env_result.winning_states;
+        CUDD::BDD non_environment_winning_region;
+        if (neg_env_game) {
+            non_environment_winning_region = neg_env_game->winning_states();
+        } else {
+            ReachabilitySynthesizer neg_env_synthesizer(arena_[0],
+                                                        starting_player_,
+                                                        Player::Agent,  // gets env winning region from agent's
+                                                        neg_goal, // Lifting
+                                                        var_mgr_->cudd_mgr()->bddOne(),
+                                                        options_.for_game("negated-environment"));
+            SynthesisResult env_result = neg_env_synthesizer.run();
+            non_environment_winning_region = env_result.winning_states;
+        }
 
         // Step 5. Restrict arena to environemt winning region.
         // i.e. all states that are in non_environment_winning_region have to be pruned as invalid
@@ -161,10 +224,11 @@ namespace Syft {
                                                             starting_player_,
                                                             Player::Agent,
                                                             coop_goal, // Lifting
-                                                            !non_environment_winning_region); 
+                                                            !non_environment_winning_region,
+                                                            options_.for_game("cooperative")); 
         best_effort_result.cooperative = coop_synthesizer.run();
         double t_coopGame = coopGame.stop().count() / 1000.0;
-        running_times_.push_back(t_coopGame);
+        running_times_.push_back(reordering_clock_.exclude(t_coopGame));
         std::cout << "DONE in " << t_coopGame << " s" << std::endl; 
 
         if (dominance_check_) {
@@ -177,125 +241,33 @@ namespace Syft {
                 best_effort_result.dominant = true;
                 double domTest_t = domTest.stop().count() / 1000.0;
                 std::cout << "succeeds. Synthesized best-effort strategy is winning. DONE in " <<  domTest_t << " s" << std::endl;
-                running_times_.push_back(domTest_t);
+                running_times_.push_back(reordering_clock_.exclude(domTest_t));
                 return best_effort_result;
             } else if (!best_effort_result.cooperative.realizability) {
                 best_effort_result.dominant = true;
                 double domTest_t = domTest.stop().count() / 1000.0;
                 std::cout << "succeeds. Synthesized best-effort strategy is losing. DONE in " <<  domTest_t << " s" << std::endl;
-                running_times_.push_back(domTest_t);
+                running_times_.push_back(reordering_clock_.exclude(domTest_t));
                 return best_effort_result;
             }
 
-            // number of state variables
-            int non_state_vars = var_mgr_->get_index_to_name().size();
-
-            // initial state vector
-            std::vector<int> vars_init(non_state_vars, 0);
-            std::vector<int> goal_init = symbolic_dfas_[0].initial_state();
-            std::vector<int> env_init = symbolic_dfas_[1].initial_state();
-            std::vector<int> tau_init = symbolic_dfas_[2].initial_state();
-
-            std::vector<int> initial_state;
-            initial_state.insert(initial_state.end(), vars_init.begin(), vars_init.end());
-            initial_state.insert(initial_state.end(), goal_init.begin(), goal_init.end());
-            initial_state.insert(initial_state.end(), env_init.begin(), env_init.end());
-            initial_state.insert(initial_state.end(), tau_init.begin(), tau_init.end());
-
-            // transition function and regions
-            std::vector<CUDD::BDD> transition_function = arena_[0].transition_function();
-            CUDD::BDD winning_region = best_effort_result.adversarial.winning_states;
-            CUDD::BDD cooperative_region = best_effort_result.cooperative.winning_states;
-            CUDD::BDD cooperative_only_region = cooperative_region * (!winning_region);
-
-            // possible environment choices
-            std::vector<std::vector<int>> env_moves = get_assignments(var_mgr_->input_variable_count());
-
-            // initially, only reached state is the initial state
-            std::unordered_set<std::vector<int>, VectorHash> reached;
-            std::queue<std::vector<int>> frontier;
-            reached.insert(initial_state);
-            frontier.push(initial_state);
-            std::unordered_set<std::vector<int>, VectorHash> expanded;
-            std::unordered_map<int, std::string> id_to_var = var_mgr_->get_index_to_name(); 
-
-            // cooperative winning strategy
-            std::unordered_map<int, CUDD::BDD> cooperative_output_function 
-                = best_effort_result.cooperative.transducer.get()->get_output_function();
-
-            if (starting_player_ == Player::Agent) {
-
-            // stores all cooperative agent moves
+            // Searches symbolically the states reached with the cooperative strategy
+            // for a witness that no dominant strategy exists
             CUDD::BDD all_cooperative_moves = 
                 get_all_cooperative_moves(arena_[0], 
                 coop_synthesizer.get_winning_states(), 
                 coop_synthesizer.get_winning_moves());
+            DominanceChecker dominance_checker(arena_[0], options_);
+            best_effort_result.dominant = dominance_checker.is_dominant(best_effort_result, all_cooperative_moves);
 
-            while (!frontier.empty()){ // forall Z in frontier
-
-                std::vector<int> state = frontier.front();
-                std::vector<int> z_state;
-                z_state.insert(z_state.end(), state.begin() + non_state_vars, state.end());
-                frontier.pop();
-
-                // search symbolically states witnessing no dominant strategy exists
-                CUDD::BDD state_bdd = var_mgr_->state_vector_to_bdd(arena_[0].automaton_id(), z_state);
-                CUDD::BDD cooperative_moves = state_bdd * all_cooperative_moves;
-                CUDD::BDD witness_move = 
-                    cooperative_moves * (!cooperative_moves.CProjection(var_mgr_->output_cube()));
-                if (witness_move != var_mgr_->cudd_mgr()->bddZero()) { // state witnesses no dominant strategy exists
-                    best_effort_result.dominant = false;
-                    double domTest_t = domTest.stop().count() / 1000.0;
-                    std::cout << "failed. Synthesized strategy is best-effort and no dominant strategy exists. DONE in " << domTest_t << " s" << std::endl;
-                    running_times_.push_back(domTest_t);
-                    return best_effort_result;
-                } else { // if current state is not a witness, it should be expanded
-                    std::vector<int> transition = state;
-                    for (int i = 0; i < id_to_var.size(); ++i) { // fixes agent choice
-                        std::string var = id_to_var[i];
-                        int agent_eval;
-                        if (var_mgr_->is_output_variable(var)) {
-                            transition[i] = cooperative_output_function[i].Eval(state.data()).IsOne();
-                        }
-                    }
-
-                    for (const auto& env_choice : env_moves) { // for every environment choice
-
-                        int curr_x = 0;
-
-                        for (int i = 0; i < id_to_var.size(); ++i) {
-                            std::string var = id_to_var[i];
-                            if (var_mgr_->is_input_variable(var)) {
-                                transition[i] = env_choice[curr_x];
-                                curr_x = curr_x + 1;
-                            }
-                        }
-
-                    // construct successor state
-                    std::vector<int> successor_state;
-                    successor_state.insert(successor_state.end(), vars_init.begin(), vars_init.end());
-                    for (const auto& bdd : transition_function) successor_state.push_back(bdd.Eval(transition.data()).IsOne());
-
-                    if (cooperative_only_region.Eval(successor_state.data()).IsOne()) {
-                        reached.insert(successor_state);
-                        if (expanded.find(successor_state) == expanded.end()) {
-                            frontier.push(successor_state);
-                        }
-                    }
-                    expanded.insert(state);
-                    }
-
-                    if (reached == expanded) { // if a fixpoint is reached
-                        best_effort_result.dominant = true;
-                        double domTest_t = domTest.stop().count() / 1000.0;
-                        std::cout << "Synthesized strategy is best-effort and dominant. DONE in " << domTest_t << " s" << std::endl;
-                        running_times_.push_back(domTest_t);
-                        return best_effort_result;
-                    }
-                }
+            double domTest_t = domTest.stop().count() / 1000.0;
+            if (best_effort_result.dominant) {
+                std::cout << "Synthesized strategy is best-effort and dominant. DONE in " << domTest_t << " s" << std::endl;
+            } else {
+                std::cout << "failed. Synthesized strategy is best-effort and no dominant strategy exists. DONE in " << domTest_t << " s" << std::endl;
             }
+            running_times_.push_back(reordering_clock_.exclude(domTest_t));
         }
-    }
     return best_effort_result;
 }
 
@@ -331,7 +303,19 @@ namespace Syft {
     }
 
     std::vector<double> ExplicitCompositionalBestEffortSynthesizer::get_running_times() const {
-        return running_times_;
+        std::vector<double> running_times = running_times_;
+        if (reordering_enabled(options_)) {
+            running_times.push_back(reordering_clock_.total());
+        }
+        return running_times;
+    }
+
+    ProblemSize ExplicitCompositionalBestEffortSynthesizer::get_problem_size() const {
+        return problem_size_;
+    }
+
+    StrategyExecutor ExplicitCompositionalBestEffortSynthesizer::strategy_executor(const BestEffortSynthesisResult& best_effort_result) const {
+        return StrategyExecutor(arena_[0], best_effort_result);
     }
 
     CUDD::BDD ExplicitCompositionalBestEffortSynthesizer::get_all_cooperative_moves(const SymbolicStateDfa& arena, const CUDD::BDD& cooperative_states, const CUDD::BDD& cooperative_moves) const {
@@ -417,7 +401,15 @@ void ExplicitCompositionalBestEffortSynthesizer::interactive(
         CUDD::BDD winning_region = best_effort_result.adversarial.winning_states;
         CUDD::BDD cooperative_region = best_effort_result.cooperative.winning_states;
         // CUDD::BDD witness_region = best_effort_result.dominance.witness_states;
-        std::unordered_map<int, CUDD::BDD> output_function;
+        // Output and transition functions are fetched once rather than at every step
+        const std::unordered_map<int, CUDD::BDD> adversarial_output_function =
+            best_effort_result.adversarial.transducer.get()->get_output_function();
+        const std::unordered_map<int, CUDD::BDD> cooperative_output_function =
+            best_effort_result.cooperative.transducer.get()->get_output_function();
+        const std::vector<std::vector<CUDD::BDD>> transition_functions = {symbolic_dfas_[0].transition_function(),
+                                                                          symbolic_dfas_[1].transition_function(),
+                                                                          symbolic_dfas_[2].transition_function()};
+        const std::unordered_map<int, CUDD::BDD>* output_function = nullptr;
         std::unordered_map<int, CUDD::BDD> alternative_output_function;
 
         std::unordered_map<int, std::string> id_to_var = var_mgr_->get_index_to_name(); 
@@ -434,10 +426,10 @@ void ExplicitCompositionalBestEffortSynthesizer::interactive(
             bool state_is_witness = false;
             if (winning_region.Eval(state.data()).IsOne()) {
                 std::cout << "[BeSyft][interactive] Agent in winning region uses winning strategy" << std::endl;
-                output_function = best_effort_result.adversarial.transducer.get()->get_output_function();
+                output_function = &adversarial_output_function;
             } else if (cooperative_region.Eval(state.data()).IsOne()) {
                 std::cout << "[BeSyft][interactive] Agent in cooperative region uses cooperative strategy" << std::endl;
-                output_function = best_effort_result.cooperative.transducer.get()->get_output_function();
+                output_function = &cooperative_output_function;
                 // if (dominance_check_ & !best_effort_result.dominance.existence) {
                 //     if (witness_region.Eval(state.data()).IsOne()) {
                 //         state_is_witness = true;
@@ -463,7 +455,7 @@ void ExplicitCompositionalBestEffortSynthesizer::interactive(
                     if (var_mgr_->is_output_variable(var)) {
                         std::cout << "Variable: " << var;
                         std::cout << ". Agent output (0 = false, 1 = true): ";
-                        agent_eval = output_function[i].Eval(state.data()).IsOne();
+                        agent_eval = output_function->at(i).Eval(state.data()).IsOne();
                         std::cout << agent_eval << std::endl;
                         transition[i] = agent_eval;
                     }
@@ -522,7 +514,7 @@ void ExplicitCompositionalBestEffortSynthesizer::interactive(
                     if (var_mgr_->is_output_variable(var)) {
                         std::cout << "Variable: " << var;
                         std::cout << ". Agent output (0 = false, 1 = true): ";
-                        agent_eval = output_function[i].Eval(state.data()).IsOne();
+                        agent_eval = output_function->at(i).Eval(state.data()).IsOne();
                         std::cout << agent_eval << std::endl;
                         transition[i] = agent_eval;
                     }
@@ -552,16 +544,16 @@ void ExplicitCompositionalBestEffortSynthesizer::interactive(
             // successor state
             int curr_state_var = id_to_var.size();
             std::vector<int> new_state = state;
-            for (int i = 0; i < symbolic_dfas_[0].transition_function().size(); ++i) {
-                new_state[curr_state_var] = symbolic_dfas_[0].transition_function()[i].Eval(transition.data()).IsOne();
+            for (int i = 0; i < transition_functions[0].size(); ++i) {
+                new_state[curr_state_var] = transition_functions[0][i].Eval(transition.data()).IsOne();
                 ++curr_state_var;
             }
-            for (int i = 0; i < symbolic_dfas_[1].transition_function().size(); ++i) {
-                new_state[curr_state_var] = symbolic_dfas_[1].transition_function()[i].Eval(transition.data()).IsOne();
+            for (int i = 0; i < transition_functions[1].size(); ++i) {
+                new_state[curr_state_var] = transition_functions[1][i].Eval(transition.data()).IsOne();
                 ++curr_state_var;
             }
-            for (int i = 0; i < symbolic_dfas_[2].transition_function().size(); ++i) {
-                new_state[curr_state_var] = symbolic_dfas_[2].transition_function()[i].Eval(transition.data()).IsOne();
+            for (int i = 0; i < transition_functions[2].size(); ++i) {
+                new_state[curr_state_var] = transition_functions[2][i].Eval(transition.data()).IsOne();
                 ++curr_state_var;
             }
             std::cout << "[BeSyft][interactive] Successor state: ";
@@ -583,23 +575,5 @@ void ExplicitCompositionalBestEffortSynthesizer::interactive(
         }
     }
 
-    std::vector<std::vector<int>> ExplicitCompositionalBestEffortSynthesizer::get_assignments(int n) const {
-
-        // std::cout << n << std::endl;
-
-        if (n == 1) return {{0}, {1}};
-
-        std::vector<std::vector<int>> rest = get_assignments(n-1);
-        std::vector<std::vector<int>> appended;
-        for (const auto& v: rest) {
-            std::vector<int> v0 = v;
-            std::vector<int> v1 = v;
-            v0.push_back(0);
-            appended.push_back(v0);
-            v1.push_back(1);
-            appended.push_back(v1);
-        }
-        return appended;
-    }
 
 }
\ No newline at end of file
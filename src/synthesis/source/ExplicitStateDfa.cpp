@@ -7,6 +7,8 @@
 #include <boost/algorithm/string/split.hpp>
 #include <boost/algorithm/string/trim.hpp>
 
+#include "Tracer.h"
+
 namespace Syft {
 
 ExplicitStateDfa::ExplicitStateDfa(std::shared_ptr<VarMgr> var_mgr)
@@ -216,6 +218,8 @@ std::string ExplicitStateDfa::safetyltl_to_dfa_file(const std::string& safetyltl
 
 ExplicitStateDfa ExplicitStateDfa::from_dfa_mona(std::shared_ptr<VarMgr> var_mgr,
                                                  const ExplicitStateDfaMona &explicit_dfa) {
+    Tracer::Scope trace("from_dfa_mona", "encoding", var_mgr->cudd_mgr());
+
     std::size_t initial_state = explicit_dfa.get_initial_state();
 
     std::vector<std::string> variable_names = explicit_dfa.names;
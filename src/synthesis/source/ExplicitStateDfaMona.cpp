@@ -4,12 +4,22 @@
 
 #include "ExplicitStateDfaMona.h"
 
+#include "DfaCache.h"
+#include "Tracer.h"
 #include "spotparser.h"
+#include <cstdio>
+#include <filesystem>
+#include <functional>
+#include <optional>
 #include <iostream>
 #include <istream>
 #include <queue>
+#include <stdexcept>
 #include <tuple>
 #include <unordered_map>
+#include <unordered_set>
+#include <sys/wait.h>
+#include <unistd.h>
 #include <lydia/mona_ext/mona_ext_base.hpp>
 #include <lydia/dfa/mona_dfa.hpp>
 #include <lydia/parser/ldlf/driver.cpp>
@@ -22,6 +32,125 @@
 namespace Syft
 {
 
+    namespace
+    {
+        // DFAs of the formulas selected for memoization translated so far
+        std::unordered_set<std::string> memoized_formulas;
+        std::unordered_map<std::string, ExplicitStateDfaMona> memoized_dfas;
+
+        std::optional<ExplicitStateDfaMona> memoized(const std::string &formula)
+        {
+            auto it = memoized_dfas.find(formula);
+            if (it == memoized_dfas.end())
+                return std::nullopt;
+            return it->second;
+        }
+
+        void memoize(const std::string &formula, const ExplicitStateDfaMona &dfa)
+        {
+            if (memoized_formulas.count(formula) > 0)
+                memoized_dfas.emplace(formula, dfa);
+        }
+
+        // DFAs translated by another process for the next job, each used once
+        std::unordered_map<std::string, ExplicitStateDfaMona> provided_dfas;
+
+        std::optional<ExplicitStateDfaMona> take_provided(const std::string &formula)
+        {
+            auto it = provided_dfas.find(formula);
+            if (it == provided_dfas.end())
+                return std::nullopt;
+            ExplicitStateDfaMona dfa = it->second;
+            provided_dfas.erase(it);
+            memoize(formula, dfa);
+            return dfa;
+        }
+
+        // Runs each task in a forked worker process, with at most jobs workers
+        // at a time. A worker saves its DFA to a temporary file in MONA's
+        // export format, and the DFA is loaded back once the worker exits.
+        std::vector<ExplicitStateDfaMona> run_in_workers(
+            const std::vector<std::function<ExplicitStateDfaMona()>> &tasks,
+            std::size_t jobs)
+        {
+            std::string dir_template =
+                (std::filesystem::temp_directory_path() / "besyft-XXXXXX").string();
+            if (mkdtemp(dir_template.data()) == nullptr)
+                throw std::runtime_error("Error: could not create a directory for worker processes.");
+            std::filesystem::path dir(dir_template);
+
+            std::vector<std::string> filenames;
+            for (std::size_t i = 0; i < tasks.size(); i++)
+                filenames.push_back((dir / (std::to_string(i) + ".dfa")).string());
+
+            std::unordered_map<pid_t, std::size_t> running;
+            std::size_t next = 0;
+            bool failed = false;
+
+            while (next < tasks.size() || !running.empty())
+            {
+                if (!failed && next < tasks.size() && running.size() < std::max<std::size_t>(jobs, 1))
+                {
+                    // Buffered output would otherwise be printed by both processes
+                    std::cout.flush();
+                    std::fflush(stdout);
+
+                    pid_t pid = fork();
+                    if (pid < 0)
+                    {
+                        failed = true;
+                        continue;
+                    }
+                    if (pid == 0)
+                    {
+                        int status = 0;
+                        try
+                        {
+                            tasks[next]().dfa_export(filenames[next]);
+                        }
+                        catch (const std::exception &e)
+                        {
+                            std::cerr << e.what() << std::endl;
+                            status = 1;
+                        }
+                        std::cout.flush();
+                        std::fflush(stdout);
+                        _exit(status);
+                    }
+                    running[pid] = next++;
+                }
+                else if (!running.empty())
+                {
+                    int status;
+                    pid_t pid = waitpid(-1, &status, 0);
+                    if (pid < 0 || running.erase(pid) == 0)
+                        continue;
+                    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+                        failed = true;
+                }
+                else
+                {
+                    break;
+                }
+            }
+
+            std::vector<ExplicitStateDfaMona> results;
+            if (!failed)
+            {
+                results.reserve(tasks.size());
+                for (const std::string &filename : filenames)
+                    results.push_back(ExplicitStateDfaMona::dfa_import(filename));
+            }
+
+            std::filesystem::remove_all(dir);
+
+            if (failed)
+                throw std::runtime_error("Error: a worker process failed to construct a DFA.");
+
+            return results;
+        }
+    }
+
     void ExplicitStateDfaMona::dfa_print()
     {
         std::cout << "Number of states " +
@@ -140,8 +269,32 @@ namespace Syft
         return res;
     }
 
-    ExplicitStateDfaMona ExplicitStateDfaMona::dfa_of_formula(const std::string &formula)
+    ExplicitStateDfaMona ExplicitStateDfaMona::dfa_of_formula(const std::string &formula,
+                                                              const std::string &cache_directory)
     {
+        Tracer::Scope trace("dfa_of_formula", "dfa", formula);
+
+        std::optional<ExplicitStateDfaMona> memoized_dfa = memoized(formula);
+        if (!memoized_dfa)
+            memoized_dfa = take_provided(formula);
+        if (memoized_dfa)
+            return *memoized_dfa;
+
+        if (!cache_directory.empty())
+        {
+            DfaCache cache(cache_directory);
+            std::optional<ExplicitStateDfaMona> cached_dfa = cache.load(formula);
+            if (cached_dfa)
+            {
+                memoize(formula, *cached_dfa);
+                return *cached_dfa;
+            }
+
+            ExplicitStateDfaMona translated_dfa = dfa_of_formula(formula);
+            cache.store(formula, translated_dfa);
+            return translated_dfa;
+        }
+
         whitemech::lydia::Logger logger("main");
         whitemech::lydia::Logger::level(whitemech::lydia::LogLevel::info);
 
@@ -178,6 +331,7 @@ namespace Syft
         DFA *d = dfaCopy(my_mona_dfa->dfa_);
 
         ExplicitStateDfaMona exp_dfa(d, my_mona_dfa->names);
+        memoize(formula, exp_dfa);
 
         // std::cout << "Number of states " +
         //                  std::to_string(exp_dfa.get_nb_variables())
@@ -186,9 +340,141 @@ namespace Syft
         return exp_dfa;
     }
 
+    std::vector<ExplicitStateDfaMona> ExplicitStateDfaMona::dfas_of_formulas(const std::vector<std::string> &formulas,
+                                                                             std::size_t jobs,
+                                                                             const std::string &cache_directory)
+    {
+        Tracer::Scope trace("dfas_of_formulas", "dfa",
+                            std::to_string(formulas.size()) + " formulas");
+
+        std::vector<ExplicitStateDfaMona> dfas;
+
+        if (jobs <= 1 || formulas.size() <= 1)
+        {
+            for (const std::string &formula : formulas)
+                dfas.push_back(dfa_of_formula(formula, cache_directory));
+            return dfas;
+        }
+
+        // Only formulas missing from memory and from the cache are handed to
+        // workers
+        std::vector<std::optional<ExplicitStateDfaMona>> cached_dfas(formulas.size());
+        std::vector<std::size_t> missing;
+        for (std::size_t i = 0; i < formulas.size(); i++)
+        {
+            cached_dfas[i] = memoized(formulas[i]);
+            if (!cached_dfas[i])
+                cached_dfas[i] = take_provided(formulas[i]);
+            if (!cached_dfas[i] && !cache_directory.empty())
+                cached_dfas[i] = DfaCache(cache_directory).load(formulas[i]);
+            if (!cached_dfas[i])
+                missing.push_back(i);
+        }
+
+        std::vector<std::function<ExplicitStateDfaMona()>> tasks;
+        for (std::size_t i : missing)
+        {
+            const std::string &formula = formulas[i];
+            tasks.push_back([&formula, &cache_directory]()
+                            { return dfa_of_formula(formula, cache_directory); });
+        }
+
+        std::vector<ExplicitStateDfaMona> translated_dfas;
+        if (tasks.size() == 1)
+            translated_dfas.push_back(tasks[0]());
+        else if (!tasks.empty())
+            translated_dfas = run_in_workers(tasks, jobs);
+
+        // Workers memoize in their own address space, hence translated DFAs
+        // are memoized again here
+        for (std::size_t i = 0; i < missing.size(); i++)
+        {
+            memoize(formulas[missing[i]], translated_dfas[i]);
+            cached_dfas[missing[i]] = translated_dfas[i];
+        }
+
+        for (std::optional<ExplicitStateDfaMona> &dfa : cached_dfas)
+            dfas.push_back(*dfa);
+        return dfas;
+    }
+
+    void ExplicitStateDfaMona::set_memoized_formulas(const std::unordered_set<std::string> &formulas)
+    {
+        memoized_formulas = formulas;
+        for (auto it = memoized_dfas.begin(); it != memoized_dfas.end();)
+        {
+            if (memoized_formulas.count(it->first) == 0)
+                it = memoized_dfas.erase(it);
+            else
+                ++it;
+        }
+    }
+
+    bool ExplicitStateDfaMona::has_memoized_dfa(const std::string &formula)
+    {
+        return memoized_dfas.count(formula) > 0;
+    }
+
+    void ExplicitStateDfaMona::provide_dfas(std::unordered_map<std::string, ExplicitStateDfaMona> dfas)
+    {
+        provided_dfas = std::move(dfas);
+    }
+
+    void ExplicitStateDfaMona::clear_provided_dfas()
+    {
+        provided_dfas.clear();
+    }
+
+    void ExplicitStateDfaMona::dfa_export(const std::string &filename) const
+    {
+        std::vector<char *> name_pointers;
+        for (const std::string &name : names)
+            name_pointers.push_back(const_cast<char *>(name.c_str()));
+        // All variables are Boolean
+        std::vector<char> orders(names.size(), 0);
+
+        if (!dfaExport(dfa_, const_cast<char *>(filename.c_str()), names.size(),
+                       name_pointers.data(), orders.data()))
+            throw std::runtime_error("Error: could not write DFA to " + filename + ".");
+    }
+
+    std::size_t ExplicitStateDfaMona::node_count(const std::vector<ExplicitStateDfaMona> &dfas)
+    {
+        std::size_t count = 0;
+        for (const ExplicitStateDfaMona &dfa : dfas)
+            count += bdd_size(dfa.dfa_->bddm) + dfa.dfa_->ns;
+        return count;
+    }
+
+    ExplicitStateDfaMona ExplicitStateDfaMona::dfa_import(const std::string &filename)
+    {
+        char **variables = nullptr;
+        int *orders = nullptr;
+        DFA *dfa = dfaImport(const_cast<char *>(filename.c_str()), &variables, &orders);
+
+        if (dfa == nullptr)
+            throw std::runtime_error("Error: could not read DFA from " + filename + ".");
+
+        // The array of variable names is null-terminated
+        std::vector<std::string> variable_names;
+        for (char **variable = variables; *variable != nullptr; variable++)
+        {
+            variable_names.emplace_back(*variable);
+            mem_free(*variable);
+        }
+        mem_free(variables);
+        mem_free(orders);
+
+        return ExplicitStateDfaMona(dfa, variable_names);
+    }
+
     // all the names may not be the same, needs a map for right indices
-    ExplicitStateDfaMona ExplicitStateDfaMona::dfa_product(const std::vector<ExplicitStateDfaMona> &dfa_vector)
+    ExplicitStateDfaMona ExplicitStateDfaMona::dfa_product(const std::vector<ExplicitStateDfaMona> &dfa_vector,
+                                                           std::size_t jobs)
     {
+        Tracer::Scope trace("dfa_product", "dfa",
+                            std::to_string(dfa_vector.size()) + " DFAs");
+
         // first record all variables, as they may not have the same alphabet
         std::unordered_map<std::string, int> name_to_index = {};
         std::vector<std::string> name_vector;
@@ -232,6 +518,42 @@ namespace Syft
             queue(renamed_dfa_vector.begin(), renamed_dfa_vector.end(), cmp);
         while (queue.size() > 1)
         {
+            std::size_t pair_count = std::min(jobs, queue.size() / 2);
+            if (pair_count > 1)
+            {
+                // multiply the 2 * pair_count smallest DFAs in disjoint pairs,
+                // each pair in its own worker process
+                std::vector<std::pair<DFA *, DFA *>> pairs;
+                for (std::size_t i = 0; i < pair_count; i++)
+                {
+                    DFA *lhs = queue.top();
+                    queue.pop();
+                    DFA *rhs = queue.top();
+                    queue.pop();
+                    pairs.emplace_back(lhs, rhs);
+                }
+
+                std::vector<std::function<ExplicitStateDfaMona()>> tasks;
+                for (const auto &pair : pairs)
+                    tasks.push_back([&pair, &name_vector]()
+                                    {
+                                        DFA *tmp = dfaProduct(pair.first, pair.second, dfaProductType::dfaAND);
+                                        DFA *res = dfaMinimize(tmp);
+                                        dfaFree(tmp);
+                                        return ExplicitStateDfaMona(res, name_vector); });
+
+                std::vector<ExplicitStateDfaMona> products = run_in_workers(tasks, pair_count);
+
+                for (const auto &pair : pairs)
+                {
+                    dfaFree(pair.first);
+                    dfaFree(pair.second);
+                }
+                for (const ExplicitStateDfaMona &product : products)
+                    queue.push(dfaCopy(product.dfa_));
+                continue;
+            }
+
             DFA *lhs = queue.top();
             queue.pop();
             DFA *rhs = queue.top();
@@ -258,6 +580,8 @@ namespace Syft
 
     ExplicitStateDfaMona ExplicitStateDfaMona::dfa_minimize(const ExplicitStateDfaMona &d)
     {
+        Tracer::Scope trace("dfa_minimize", "dfa");
+
         //logger.info("Determinizing DFA...");
         DFA *res = dfaMinimize(d.dfa_);
         ExplicitStateDfaMona res_dfa(res, d.names);
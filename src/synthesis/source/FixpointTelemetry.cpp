@@ -0,0 +1,68 @@
+#include "FixpointTelemetry.h"
+
+#include <stdexcept>
+
+#include "Json.h"
+
+namespace Syft {
+
+FixpointTelemetry::FixpointTelemetry(const std::string& filename,
+                                     const std::string& game,
+                                     const std::string& job,
+                                     std::shared_ptr<VarMgr> var_mgr,
+                                     std::size_t automaton_id)
+    : game_(game)
+    , job_(job)
+    , var_mgr_(std::move(var_mgr))
+    , state_variable_count_(var_mgr_->state_variable_count(automaton_id))
+    , iteration_(0) {
+  if (!filename.empty()) {
+    out_ = std::make_unique<std::ofstream>(filename, std::ios::app);
+
+    if (!*out_) {
+      throw std::runtime_error("Error: could not open " + filename + ".");
+    }
+  }
+}
+
+bool FixpointTelemetry::enabled() const {
+  return out_ != nullptr;
+}
+
+void FixpointTelemetry::start_iteration() {
+  if (!enabled()) return;
+
+  preimage_start_ = Clock::now();
+}
+
+void FixpointTelemetry::start_projection() {
+  if (!enabled()) return;
+
+  projection_start_ = Clock::now();
+}
+
+void FixpointTelemetry::end_iteration(const CUDD::BDD& winning_states,
+                                      const CUDD::BDD& winning_moves) {
+  if (!enabled()) return;
+
+  Clock::time_point projection_end = Clock::now();
+  std::chrono::duration<double> preimage_time =
+    projection_start_ - preimage_start_;
+  std::chrono::duration<double> projection_time =
+    projection_end - projection_start_;
+
+  *out_ << "{\"game\":" << json_string(game_)
+        << ",\"job\":" << json_string(job_)
+        << ",\"iteration\":" << iteration_++
+        << ",\"winning_states_nodes\":" << winning_states.nodeCount()
+        << ",\"winning_moves_nodes\":" << winning_moves.nodeCount()
+        << ",\"winning_states\":"
+        << winning_states.CountMinterm(state_variable_count_)
+        << ",\"preimage_s\":" << preimage_time.count()
+        << ",\"projection_s\":" << projection_time.count()
+        << ",\"peak_live_nodes\":"
+        << var_mgr_->cudd_mgr()->ReadPeakLiveNodeCount()
+        << "}" << std::endl;
+}
+
+}
@@ -0,0 +1,58 @@
+#include "LazyTransducer.h"
+
+#include <stdexcept>
+
+namespace Syft {
+
+LazyTransducer::LazyTransducer(
+    std::function<std::unique_ptr<Transducer>()> construct)
+    : construct_(std::move(construct)) {}
+
+LazyTransducer LazyTransducer::for_winning_moves(
+    const SymbolicStateDfa& spec,
+    std::vector<int> initial_vector,
+    const CUDD::BDD& winning_moves,
+    Player starting_player,
+    Player protagonist_player,
+    const SynthesisOptions& options) {
+  if (options.realizability_only) return LazyTransducer();
+
+  return LazyTransducer(
+      [var_mgr = spec.var_mgr(), initial_vector = std::move(initial_vector),
+       winning_moves, transition_function = spec.transition_function(),
+       starting_player, protagonist_player,
+       verify = options.verify_strategies]() {
+        return Transducer::from_winning_moves(var_mgr, initial_vector,
+                                              winning_moves,
+                                              transition_function,
+                                              starting_player,
+                                              protagonist_player, verify);
+      });
+}
+
+LazyTransducer::operator bool() const {
+  return transducer_ != nullptr || construct_ != nullptr;
+}
+
+Transducer* LazyTransducer::get() const {
+  if (!transducer_) {
+    if (!construct_) {
+      throw std::runtime_error("Error: No strategy was synthesized.");
+    }
+    transducer_ = construct_();
+    // Releases the BDDs the strategy was constructed from
+    construct_ = nullptr;
+  }
+
+  return transducer_.get();
+}
+
+Transducer* LazyTransducer::operator->() const {
+  return get();
+}
+
+Transducer& LazyTransducer::operator*() const {
+  return *get();
+}
+
+}
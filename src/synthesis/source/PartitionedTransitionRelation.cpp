@@ -0,0 +1,247 @@
+#include "PartitionedTransitionRelation.h"
+
+#include <algorithm>
+#include <set>
+#include <stdexcept>
+
+namespace Syft {
+
+PartitionedTransitionRelation::PartitionedTransitionRelation(
+    const SymbolicStateDfa& dfa,
+    std::size_t cluster_size,
+    const CUDD::BDD& existential_cube)
+    : PartitionedTransitionRelation(dfa, dfa.transition_function(),
+                                    cluster_size, existential_cube, false) {}
+
+PartitionedTransitionRelation::PartitionedTransitionRelation(
+    const SymbolicStateDfa& dfa,
+    const std::vector<CUDD::BDD>& transition_function,
+    std::size_t cluster_size,
+    const CUDD::BDD& existential_cube,
+    bool forward)
+    : var_mgr_(dfa.var_mgr())
+    , forward_(forward) {
+  std::size_t automaton_id = dfa.automaton_id();
+
+  var_mgr_->create_next_state_variables(automaton_id);
+  state_variables_ = var_mgr_->state_variables(automaton_id);
+  next_state_variables_ = var_mgr_->next_state_variables(automaton_id);
+
+  std::vector<CUDD::BDD> bit_relations;
+  bit_relations.reserve(transition_function.size());
+
+  for (std::size_t i = 0; i < transition_function.size(); ++i) {
+    bit_relations.push_back(
+        next_state_variables_[i].Xnor(transition_function[i]));
+  }
+
+  clusters_ = cluster(bit_relations, cluster_size);
+
+  // Images abstract the current state, preimages the next state
+  const std::vector<CUDD::BDD>& quantified_states =
+    forward_ ? state_variables_ : next_state_variables_;
+  schedule(existential_cube *
+           var_mgr_->cudd_mgr()->computeCube(quantified_states));
+}
+
+PartitionedTransitionRelation PartitionedTransitionRelation::forward(
+    const SymbolicStateDfa& dfa,
+    const std::vector<CUDD::BDD>& transition_function,
+    std::size_t cluster_size,
+    const CUDD::BDD& existential_cube) {
+  return PartitionedTransitionRelation(dfa, transition_function, cluster_size,
+                                       existential_cube, true);
+}
+
+std::vector<CUDD::BDD> PartitionedTransitionRelation::cluster(
+    const std::vector<CUDD::BDD>& bit_relations,
+    std::size_t cluster_size) const {
+  std::size_t relation_count = bit_relations.size();
+  std::vector<std::set<unsigned int>> supports;
+  supports.reserve(relation_count);
+
+  for (const CUDD::BDD& relation : bit_relations) {
+    std::vector<unsigned int> support = relation.SupportIndices();
+    supports.emplace_back(support.begin(), support.end());
+  }
+
+  std::vector<CUDD::BDD> clusters;
+  std::vector<bool> clustered(relation_count, false);
+  std::size_t clustered_count = 0;
+
+  while (clustered_count < relation_count) {
+    // Seeds a new cluster with the first relation not yet clustered
+    std::size_t seed = std::find(clustered.begin(), clustered.end(), false) -
+      clustered.begin();
+    CUDD::BDD current = bit_relations[seed];
+    std::set<unsigned int> current_support = supports[seed];
+    clustered[seed] = true;
+    ++clustered_count;
+
+    while (clustered_count < relation_count) {
+      // Picks the relation whose support overlaps the most with the cluster's
+      std::size_t best = relation_count;
+      double best_affinity = -1.0;
+
+      for (std::size_t i = 0; i < relation_count; ++i) {
+        if (clustered[i]) continue;
+
+        std::size_t shared = 0;
+        for (unsigned int index : supports[i]) {
+          shared += current_support.count(index);
+        }
+
+        std::size_t total = current_support.size() + supports[i].size() - shared;
+        double affinity = total == 0 ? 1.0 : (double) shared / total;
+
+        if (affinity > best_affinity) {
+          best = i;
+          best_affinity = affinity;
+        }
+      }
+
+      CUDD::BDD merged = current & bit_relations[best];
+
+      if (merged.nodeCount() > (int) cluster_size) break;
+
+      current = merged;
+      current_support.insert(supports[best].begin(), supports[best].end());
+      clustered[best] = true;
+      ++clustered_count;
+    }
+
+    clusters.push_back(current);
+  }
+
+  return clusters;
+}
+
+void PartitionedTransitionRelation::schedule(
+    const CUDD::BDD& quantified_cube) {
+  // Variables that can be quantified as soon as no remaining cluster
+  // depends on them
+  std::vector<unsigned int> quantified = quantified_cube.SupportIndices();
+  std::set<unsigned int> quantifiable(quantified.begin(), quantified.end());
+
+  std::size_t cluster_count = clusters_.size();
+  std::vector<std::set<unsigned int>> supports;
+  supports.reserve(cluster_count);
+
+  for (const CUDD::BDD& cluster : clusters_) {
+    std::vector<unsigned int> support = cluster.SupportIndices();
+    supports.emplace_back(support.begin(), support.end());
+  }
+
+  // Greedily picks next the cluster after which the most variables can be
+  // quantified, preferring clusters that bring in few new variables
+  std::vector<std::size_t> order;
+  std::vector<bool> scheduled(cluster_count, false);
+  std::set<unsigned int> seen;
+
+  while (order.size() < cluster_count) {
+    std::size_t best = cluster_count;
+    long best_score = 0;
+
+    for (std::size_t i = 0; i < cluster_count; ++i) {
+      if (scheduled[i]) continue;
+
+      long released = 0;
+      long introduced = 0;
+
+      for (unsigned int index : supports[i]) {
+        if (seen.count(index) == 0) ++introduced;
+        if (quantifiable.count(index) == 0) continue;
+
+        bool elsewhere = false;
+        for (std::size_t j = 0; j < cluster_count && !elsewhere; ++j) {
+          elsewhere = j != i && !scheduled[j] && supports[j].count(index) > 0;
+        }
+        if (!elsewhere) ++released;
+      }
+
+      long score = released - introduced;
+      if (best == cluster_count || score > best_score) {
+        best = i;
+        best_score = score;
+      }
+    }
+
+    order.push_back(best);
+    scheduled[best] = true;
+    seen.insert(supports[best].begin(), supports[best].end());
+  }
+
+  // Each quantifiable variable is abstracted together with the last
+  // cluster in the order that depends on it
+  std::vector<CUDD::BDD> reordered_clusters;
+  reordered_clusters.reserve(cluster_count);
+  quantification_cubes_.assign(cluster_count, var_mgr_->cudd_mgr()->bddOne());
+  std::set<unsigned int> pending = quantifiable;
+
+  for (std::size_t k = cluster_count; k-- > 0; ) {
+    for (unsigned int index : supports[order[k]]) {
+      if (pending.erase(index) > 0) {
+        quantification_cubes_[k] &= var_mgr_->cudd_mgr()->bddVar(index);
+      }
+    }
+  }
+
+  for (std::size_t i : order) {
+    reordered_clusters.push_back(clusters_[i]);
+  }
+  clusters_ = std::move(reordered_clusters);
+
+  // Variables no cluster depends on, such as the state variables of a DFA
+  // whose transitions do not depend on its state, are abstracted right away
+  if (!pending.empty()) {
+    if (clusters_.empty()) {
+      clusters_.push_back(var_mgr_->cudd_mgr()->bddOne());
+      quantification_cubes_.push_back(var_mgr_->cudd_mgr()->bddOne());
+    }
+
+    for (unsigned int index : pending) {
+      quantification_cubes_[0] &= var_mgr_->cudd_mgr()->bddVar(index);
+    }
+  }
+}
+
+CUDD::BDD PartitionedTransitionRelation::transitions_into(
+    const CUDD::BDD& states) const {
+  if (forward_) {
+    throw std::runtime_error(
+        "Error: A forward transition relation cannot compute preimages.");
+  }
+
+  // Renames the states to next-state variables. The two sets are disjoint
+  // in the support of states, so a swap is a plain renaming.
+  CUDD::BDD product = states.SwapVariables(state_variables_,
+                                           next_state_variables_);
+
+  for (std::size_t i = 0; i < clusters_.size(); ++i) {
+    product = product.AndAbstract(clusters_[i], quantification_cubes_[i]);
+  }
+
+  return product;
+}
+
+CUDD::BDD PartitionedTransitionRelation::image(const CUDD::BDD& states) const {
+  if (!forward_) {
+    throw std::runtime_error(
+        "Error: A backward transition relation cannot compute images.");
+  }
+
+  CUDD::BDD product = states;
+
+  for (std::size_t i = 0; i < clusters_.size(); ++i) {
+    product = product.AndAbstract(clusters_[i], quantification_cubes_[i]);
+  }
+
+  // The current state has been abstracted, so a swap is a plain renaming
+  return product.SwapVariables(next_state_variables_, state_variables_);
+}
+
+std::size_t PartitionedTransitionRelation::cluster_count() const {
+  return clusters_.size();
+}
+
+}
@@ -0,0 +1,69 @@
+#include "Reordering.h"
+
+namespace Syft {
+
+Cudd_ReorderingType reordering_type(ReorderingMethod method) {
+  switch (method) {
+    case ReorderingMethod::Sift:
+      return CUDD_REORDER_SIFT;
+    case ReorderingMethod::SymmetricSift:
+      return CUDD_REORDER_SYMM_SIFT;
+    case ReorderingMethod::GroupSift:
+      return CUDD_REORDER_GROUP_SIFT;
+    case ReorderingMethod::Window:
+      return CUDD_REORDER_WINDOW4;
+    case ReorderingMethod::Annealing:
+      return CUDD_REORDER_ANNEALING;
+  }
+
+  return CUDD_REORDER_SIFT;
+}
+
+bool reordering_enabled(const SynthesisOptions& options) {
+  return options.dynamic_reordering || options.reorder_after_arena ||
+    options.reorder_interval > 0;
+}
+
+void configure_reordering(const CUDD::Cudd& mgr,
+                          const SynthesisOptions& options) {
+  if (options.reordering_threshold > 0) {
+    mgr.SetNextReordering(options.reordering_threshold);
+  }
+
+  if (options.max_growth > 0.0) {
+    mgr.SetMaxGrowth(options.max_growth);
+  }
+
+  if (options.dynamic_reordering) {
+    mgr.AutodynEnable(reordering_type(options.reordering_method));
+  } else {
+    mgr.AutodynDisable();
+  }
+}
+
+void reorder_variables(const CUDD::Cudd& mgr, const SynthesisOptions& options) {
+  mgr.ReduceHeap(reordering_type(options.reordering_method));
+}
+
+ReorderingClock::ReorderingClock(std::shared_ptr<CUDD::Cudd> mgr)
+    : mgr_(std::move(mgr))
+    , last_reordering_time_(mgr_->ReadReorderingTime())
+    , total_(0.0)
+{}
+
+double ReorderingClock::exclude(double seconds) {
+  long reordering_time = mgr_->ReadReorderingTime();
+  double reordering_seconds =
+    (reordering_time - last_reordering_time_) / 1000.0;
+
+  last_reordering_time_ = reordering_time;
+  total_ += reordering_seconds;
+
+  return seconds - reordering_seconds;
+}
+
+double ReorderingClock::total() const {
+  return total_;
+}
+
+}
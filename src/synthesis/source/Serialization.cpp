@@ -0,0 +1,59 @@
+#include "Serialization.h"
+
+#include <cctype>
+#include <stdexcept>
+
+namespace Syft {
+
+FilePointer open_file(const std::string& filename, const char* mode) {
+  FILE* file = std::fopen(filename.c_str(), mode);
+
+  if (file == nullptr) {
+    throw std::runtime_error("Error: could not open " + filename + ".");
+  }
+
+  return FilePointer(file, &std::fclose);
+}
+
+std::string read_token(FILE* file) {
+  int c = std::fgetc(file);
+
+  while (c != EOF && std::isspace(c)) {
+    c = std::fgetc(file);
+  }
+
+  if (c == EOF) {
+    throw std::runtime_error("Error: unexpected end of file.");
+  }
+
+  std::string token;
+
+  // Stops right after the first whitespace character, so that a binary
+  // section following the token is left untouched
+  while (c != EOF && !std::isspace(c)) {
+    token.push_back(static_cast<char>(c));
+    c = std::fgetc(file);
+  }
+
+  return token;
+}
+
+std::size_t read_number(FILE* file) {
+  std::string token = read_token(file);
+
+  if (token.empty() || token.find_first_not_of("0123456789") != std::string::npos) {
+    throw std::runtime_error("Error: expected a number, found " + token + ".");
+  }
+
+  return std::stoul(token);
+}
+
+void expect_token(FILE* file, const std::string& expected) {
+  std::string token = read_token(file);
+
+  if (token != expected) {
+    throw std::runtime_error("Error: expected " + expected + ", found " + token + ".");
+  }
+}
+
+}
@@ -0,0 +1,300 @@
+#include "StrategyExecutor.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace Syft {
+
+namespace {
+// ADD leaves are doubles, which represent integers exactly up to 2^53
+const std::size_t bits_per_add = 52;
+
+std::uint64_t pack_bits(const std::vector<int>& bits) {
+  std::uint64_t packed = 0;
+  for (std::size_t i = 0; i < bits.size(); ++i) {
+    packed |= static_cast<std::uint64_t>(bits[i] != 0) << i;
+  }
+  return packed;
+}
+}
+
+StrategyExecutor::StrategyExecutor(const SymbolicStateDfa& arena,
+                                   const BestEffortSynthesisResult& result,
+                                   std::size_t max_table_size)
+    : input_combinations_(0)
+    , current_state_(0)
+    , region_(Region::Losing) {
+  if (!result.adversarial.transducer || !result.cooperative.transducer) {
+    throw std::runtime_error(
+        "Error: Strategies cannot be executed if only realizability was decided.");
+  }
+
+  std::shared_ptr<VarMgr> var_mgr = arena.var_mgr();
+
+  for (const std::string& label : var_mgr->input_variable_labels()) {
+    input_indices_.push_back(var_mgr->name_to_variable(label).NodeReadIndex());
+  }
+
+  for (const std::string& label : var_mgr->output_variable_labels()) {
+    output_indices_.push_back(var_mgr->name_to_variable(label).NodeReadIndex());
+  }
+
+  for (const CUDD::BDD& variable :
+         var_mgr->state_variables(arena.automaton_id())) {
+    state_indices_.push_back(variable.NodeReadIndex());
+  }
+
+  initial_state_ = arena.initial_state();
+  assignment_.assign(var_mgr->cudd_mgr()->ReadSize(), 0);
+  next_state_.assign(state_indices_.size(), 0);
+
+  // Merges the strategies as in merge_and_dump_dot
+  CUDD::BDD winning_states = result.adversarial.winning_states;
+  CUDD::BDD cooperative_only_states =
+    (!winning_states) & result.cooperative.winning_states;
+
+  std::unordered_map<int, CUDD::BDD> adversarial_output_function =
+    result.adversarial.transducer->get_output_function();
+  std::unordered_map<int, CUDD::BDD> cooperative_output_function =
+    result.cooperative.transducer->get_output_function();
+
+  std::vector<CUDD::BDD> output_function;
+  output_function.reserve(output_indices_.size());
+
+  for (int index : output_indices_) {
+    output_function.push_back(
+        (adversarial_output_function.at(index) & winning_states) |
+        (cooperative_output_function.at(index) & cooperative_only_states));
+  }
+
+  output_adds_ = pack(var_mgr, output_function);
+  transition_adds_ = pack(var_mgr, arena.transition_function());
+
+  // Leaves: 2 in the winning region, 1 in the cooperative-only region
+  std::shared_ptr<CUDD::Cudd> mgr = var_mgr->cudd_mgr();
+  region_add_ = flatten(winning_states.Add() * mgr->constant(2) +
+                        cooperative_only_states.Add());
+
+  if (!tabulate(max_table_size)) {
+    input_combinations_ = 0;
+    table_outputs_.clear();
+    table_successors_.clear();
+    table_regions_.clear();
+  }
+
+  reset();
+}
+
+StrategyExecutor::FlatAdd StrategyExecutor::flatten(const CUDD::ADD& add) {
+  FlatAdd flat;
+  std::unordered_map<DdNode*, std::uint32_t> ids;
+  std::vector<DdNode*> pending = {add.getNode()};
+
+  ids[add.getNode()] = 0;
+  flat.nodes.emplace_back();
+
+  // Returns the ID of a node, assigning a new one on first visit
+  auto node_id = [&flat, &ids, &pending](DdNode* node) {
+    auto inserted = ids.emplace(node, flat.nodes.size());
+    if (inserted.second) {
+      flat.nodes.emplace_back();
+      pending.push_back(node);
+    }
+    return inserted.first->second;
+  };
+
+  while (!pending.empty()) {
+    DdNode* node = pending.back();
+    pending.pop_back();
+    std::uint32_t id = ids.at(node);
+
+    if (Cudd_IsConstant(node)) {
+      flat.nodes[id] = {-1, static_cast<std::uint32_t>(flat.values.size()), 0};
+      flat.values.push_back(static_cast<std::uint64_t>(Cudd_V(node)));
+    } else {
+      std::uint32_t then_child = node_id(Cudd_T(node));
+      std::uint32_t else_child = node_id(Cudd_E(node));
+      flat.nodes[id] = {static_cast<int>(Cudd_NodeReadIndex(node)),
+                        then_child, else_child};
+    }
+  }
+
+  return flat;
+}
+
+std::uint64_t StrategyExecutor::evaluate(const FlatAdd& add,
+                                         const std::vector<char>& assignment) {
+  const Node* node = &add.nodes[0];
+
+  while (node->variable >= 0) {
+    node = &add.nodes[assignment[node->variable] ? node->then_child
+                                                 : node->else_child];
+  }
+
+  return add.values[node->then_child];
+}
+
+void StrategyExecutor::evaluate_bits(const std::vector<FlatAdd>& adds,
+                                     const std::vector<char>& assignment,
+                                     std::vector<int>& bits) {
+  for (std::size_t k = 0; k < adds.size(); ++k) {
+    std::uint64_t packed = evaluate(adds[k], assignment);
+    std::size_t first = k * bits_per_add;
+    std::size_t last = std::min(first + bits_per_add, bits.size());
+
+    for (std::size_t i = first; i < last; ++i) {
+      bits[i] = (packed >> (i - first)) & 1;
+    }
+  }
+}
+
+std::vector<StrategyExecutor::FlatAdd> StrategyExecutor::pack(
+    const std::shared_ptr<VarMgr>& var_mgr,
+    const std::vector<CUDD::BDD>& bits) {
+  std::shared_ptr<CUDD::Cudd> mgr = var_mgr->cudd_mgr();
+  std::vector<FlatAdd> adds;
+
+  for (std::size_t first = 0; first < bits.size(); first += bits_per_add) {
+    std::size_t last = std::min(first + bits_per_add, bits.size());
+    CUDD::ADD packed = mgr->addZero();
+
+    // Bit i of a leaf is the value of the i-th function of the chunk
+    for (std::size_t i = first; i < last; ++i) {
+      packed += bits[i].Add() * mgr->constant(std::ldexp(1.0, i - first));
+    }
+
+    adds.push_back(flatten(packed));
+  }
+
+  return adds;
+}
+
+StrategyExecutor::Region StrategyExecutor::to_region(std::uint64_t value) {
+  if (value == 2) return Region::Winning;
+  if (value == 1) return Region::Cooperative;
+  return Region::Losing;
+}
+
+bool StrategyExecutor::tabulate(std::size_t max_table_size) {
+  if (input_indices_.size() >= 32 || output_indices_.size() > 64 ||
+      state_indices_.size() > 64) {
+    return false;
+  }
+
+  input_combinations_ = std::size_t(1) << input_indices_.size();
+
+  // Explores the states reachable under the strategy, numbering them in the
+  // order they are found. The initial state gets ID 0.
+  std::unordered_map<std::uint64_t, std::uint32_t> state_ids;
+  std::vector<std::uint64_t> states = {pack_bits(initial_state_)};
+  state_ids[states[0]] = 0;
+
+  std::vector<int> outputs(output_indices_.size());
+  std::vector<int> successor(state_indices_.size());
+
+  for (std::size_t id = 0; id < states.size(); ++id) {
+    if ((id + 1) * input_combinations_ > max_table_size) {
+      return false;
+    }
+
+    std::fill(assignment_.begin(), assignment_.end(), 0);
+    for (std::size_t i = 0; i < state_indices_.size(); ++i) {
+      assignment_[state_indices_[i]] = (states[id] >> i) & 1;
+    }
+
+    Region region = to_region(evaluate(region_add_, assignment_));
+    table_regions_.push_back(region);
+    table_outputs_.resize((id + 1) * input_combinations_, 0);
+    table_successors_.resize((id + 1) * input_combinations_, id);
+
+    // The strategy has no move in losing states
+    if (region == Region::Losing) continue;
+
+    for (std::size_t input = 0; input < input_combinations_; ++input) {
+      for (std::size_t i = 0; i < input_indices_.size(); ++i) {
+        assignment_[input_indices_[i]] = (input >> i) & 1;
+      }
+
+      evaluate_bits(output_adds_, assignment_, outputs);
+      for (std::size_t i = 0; i < output_indices_.size(); ++i) {
+        assignment_[output_indices_[i]] = outputs[i];
+      }
+
+      evaluate_bits(transition_adds_, assignment_, successor);
+      std::uint64_t packed_successor = pack_bits(successor);
+      auto inserted = state_ids.emplace(packed_successor, states.size());
+      if (inserted.second) {
+        states.push_back(packed_successor);
+      }
+
+      std::size_t entry = id * input_combinations_ + input;
+      table_outputs_[entry] = pack_bits(outputs);
+      table_successors_[entry] = inserted.first->second;
+    }
+  }
+
+  return true;
+}
+
+void StrategyExecutor::reset() {
+  std::fill(assignment_.begin(), assignment_.end(), 0);
+  for (std::size_t i = 0; i < state_indices_.size(); ++i) {
+    assignment_[state_indices_[i]] = initial_state_[i];
+  }
+
+  current_state_ = 0;
+  region_ = is_tabulated() ? table_regions_[0]
+                           : to_region(evaluate(region_add_, assignment_));
+}
+
+bool StrategyExecutor::step(const std::vector<int>& inputs,
+                            std::vector<int>& outputs) {
+  if (region_ == Region::Losing) return false;
+
+  if (is_tabulated()) {
+    std::size_t input = 0;
+    for (std::size_t i = 0; i < input_indices_.size(); ++i) {
+      input |= static_cast<std::size_t>(inputs[i] != 0) << i;
+    }
+
+    std::size_t entry = current_state_ * input_combinations_ + input;
+    std::uint64_t packed_outputs = table_outputs_[entry];
+    for (std::size_t i = 0; i < output_indices_.size(); ++i) {
+      outputs[i] = (packed_outputs >> i) & 1;
+    }
+
+    current_state_ = table_successors_[entry];
+    region_ = table_regions_[current_state_];
+    return true;
+  }
+
+  for (std::size_t i = 0; i < input_indices_.size(); ++i) {
+    assignment_[input_indices_[i]] = inputs[i] != 0;
+  }
+
+  evaluate_bits(output_adds_, assignment_, outputs);
+  for (std::size_t i = 0; i < output_indices_.size(); ++i) {
+    assignment_[output_indices_[i]] = outputs[i];
+  }
+
+  // The successor is computed in full before the state changes
+  evaluate_bits(transition_adds_, assignment_, next_state_);
+  for (std::size_t i = 0; i < state_indices_.size(); ++i) {
+    assignment_[state_indices_[i]] = next_state_[i];
+  }
+
+  region_ = to_region(evaluate(region_add_, assignment_));
+  return true;
+}
+
+StrategyExecutor::Region StrategyExecutor::region() const {
+  return region_;
+}
+
+bool StrategyExecutor::is_tabulated() const {
+  return !table_regions_.empty();
+}
+
+}
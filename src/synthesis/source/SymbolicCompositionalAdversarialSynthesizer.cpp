@@ -5,6 +5,7 @@
 */
 
 #include "SymbolicCompositionalAdversarialSynthesizer.h"
+#include "VariableOrdering.h"
 #include <boost/algorithm/string.hpp>
 #include <queue>
 
@@ -15,57 +16,98 @@ namespace Syft {
                             std::string agent_specification,
                             std::string environment_specification,
                             InputOutputPartition partition,
-                            Player starting_player) :   
+                            Player starting_player,
+                            SynthesisOptions options) :   
                                 var_mgr_(var_mgr),
                                 agent_specification_(agent_specification),
                                 environment_specification_(environment_specification),
                                 partition_(partition),
-                                starting_player_(starting_player)
+                                starting_player_(starting_player),
+                                options_(options),
+                                reordering_clock_(var_mgr->cudd_mgr())
     {
 
         // step 1. Construct symbolic DFA of LTLf formula E -> Phi
         Stopwatch ltlf2dfa;
         ltlf2dfa.start();
 
-        ExplicitStateDfaMona goal_dfa = 
-            ExplicitStateDfaMona::dfa_of_formula(agent_specification_);
-        ExplicitStateDfaMona env_dfa =
-            ExplicitStateDfaMona::dfa_of_formula(environment_specification_);
+        // If requested, each top-level conjunct gets its own DFA
+        std::pair<std::vector<std::string>, std::vector<std::string>> conjuncts =
+            split_specifications(agent_specification_, environment_specification_, options_.split_conjunctions);
+        const std::vector<std::string>& goal_conjuncts = conjuncts.first;
+        const std::vector<std::string>& env_conjuncts = conjuncts.second;
+
         // DFA A_{true} accepts non-empty traces only
-        ExplicitStateDfaMona tautology_dfa = 
-            ExplicitStateDfaMona::dfa_of_formula("F(true)");
+        std::vector<ExplicitStateDfaMona> formula_dfas =
+            ExplicitStateDfaMona::dfas_of_formulas(formulas(conjuncts),
+                                                   options_.jobs,
+                                                   options_.dfa_cache_directory);
 
         double t_ltlf2dfa = ltlf2dfa.stop().count() / 1000.0;
-        running_times_.push_back(t_ltlf2dfa);
+        running_times_.push_back(reordering_clock_.exclude(t_ltlf2dfa));
         std::cout << "[BeSyft] LTLf-to-DFA construction DONE in: " << t_ltlf2dfa << " s" << std::endl;
 
         Syft::Stopwatch dfa2sym;
         dfa2sym.start();
 
+        if (options_.fit_cache_to_dfas)
+            var_mgr_->fit_cache_to_dfas(ExplicitStateDfaMona::node_count(formula_dfas));
+
         // Extract propositions from formula and partition
-        var_mgr_->create_named_variables(goal_dfa.names);
-        var_mgr_->create_named_variables(env_dfa.names);
+        // All named variables are created before any state variable
+        for (const auto& formula_dfa : formula_dfas)
+            var_mgr_->create_named_variables(formula_dfa.names);
         var_mgr_->partition_variables(partition_.input_variables,
                                         partition_.output_variables);
 
-        ExplicitStateDfa explicit_goal_dfa = 
-            ExplicitStateDfa::from_dfa_mona(var_mgr_, goal_dfa);
-        ExplicitStateDfa explicit_env_dfa =
-            ExplicitStateDfa::from_dfa_mona(var_mgr_, env_dfa);
-        ExplicitStateDfa explicit_tautology_dfa =
-            ExplicitStateDfa::from_dfa_mona(var_mgr_, tautology_dfa);
-        
-        symbolic_dfa_.push_back(SymbolicStateDfa::from_explicit(std::move(explicit_goal_dfa)));
-        symbolic_dfa_.push_back(SymbolicStateDfa::from_explicit(std::move(explicit_env_dfa)));
-        symbolic_dfa_.push_back(SymbolicStateDfa::from_explicit(std::move(explicit_tautology_dfa)));
+        std::vector<SymbolicStateDfa> conjunct_dfas;
+        for (const auto& formula_dfa : formula_dfas) {
+            ExplicitStateDfa explicit_dfa =
+                ExplicitStateDfa::from_dfa_mona(var_mgr_, formula_dfa);
+            conjunct_dfas.push_back(SymbolicStateDfa::from_explicit(std::move(explicit_dfa)));
+        }
+
+        // The DFA of a conjunction is the product of the DFAs of its conjuncts
+        auto conjunction_dfa = [](std::vector<SymbolicStateDfa>::const_iterator begin,
+                                  std::vector<SymbolicStateDfa>::const_iterator end) {
+            std::vector<SymbolicStateDfa> dfas(begin, end);
+            return dfas.size() == 1 ? dfas[0] : SymbolicStateDfa::product(dfas);
+        };
+        auto goal_end = conjunct_dfas.cbegin() + goal_conjuncts.size();
+        auto env_end = goal_end + env_conjuncts.size();
+        symbolic_dfa_.push_back(conjunction_dfa(conjunct_dfas.cbegin(), goal_end));
+        symbolic_dfa_.push_back(conjunction_dfa(goal_end, env_end));
+        symbolic_dfa_.push_back(conjunct_dfas.back());
 
         arena_.push_back(SymbolicStateDfa::product(symbolic_dfa_));
 
+        VariableOrdering variable_ordering(var_mgr_, starting_player_);
+        for (std::size_t i = 0; i < conjunct_dfas.size(); ++i)
+            variable_ordering.add_automaton(conjunct_dfas[i].automaton_id(), formula_dfas[i].names);
+        variable_ordering.apply(options_);
+
         double t_dfa2sym = dfa2sym.stop().count() / 1000.0;
         std::cout << "[BeSyft] Symbolic DFA construction DONE in " << t_dfa2sym << std::endl;
-        running_times_.push_back(t_dfa2sym);
+        running_times_.push_back(reordering_clock_.exclude(t_dfa2sym));
+        problem_size_ = ProblemSize::of(formula_dfas, arena_[0]);
     }                        
 
+    std::vector<std::string> SymbolicCompositionalAdversarialSynthesizer::formulas(const std::string& agent_specification,
+            const std::string& environment_specification,
+            const SynthesisOptions& options) {
+        // If requested, each top-level conjunct gets its own DFA
+        return formulas(split_specifications(agent_specification, environment_specification,
+                                             options.split_conjunctions));
+    }
+
+    std::vector<std::string> SymbolicCompositionalAdversarialSynthesizer::formulas(
+            const std::pair<std::vector<std::string>, std::vector<std::string>>& conjuncts) {
+        std::vector<std::string> conjunct_formulas = conjuncts.first;
+        conjunct_formulas.insert(conjunct_formulas.end(), conjuncts.second.begin(), conjuncts.second.end());
+        conjunct_formulas.push_back("F(true)");
+        return conjunct_formulas;
+    }
+
     SynthesisResult SymbolicCompositionalAdversarialSynthesizer::run() 
     {
         SynthesisResult adv_result;
@@ -79,15 +121,24 @@ namespace Syft {
                                                 starting_player_,
                                                 Player::Agent,
                                                 adv_goal, // Lifting
-                                                var_mgr_->cudd_mgr()->bddOne());
+                                                var_mgr_->cudd_mgr()->bddOne(),
+                                                options_.for_game("adversarial"));
         adv_result = adv_synthesizer.run();
         double t_advGame = advGame.stop().count() / 1000.0;
-        running_times_.push_back(t_advGame);
+        running_times_.push_back(reordering_clock_.exclude(t_advGame));
         std::cout << "DONE in " << t_advGame << " s" << std::endl;
         return adv_result;
     }
 
     std::vector<double> SymbolicCompositionalAdversarialSynthesizer::get_running_times() const {
-        return running_times_;
+        std::vector<double> running_times = running_times_;
+        if (reordering_enabled(options_)) {
+            running_times.push_back(reordering_clock_.total());
+        }
+        return running_times;
     }                                      
+
+    ProblemSize SymbolicCompositionalAdversarialSynthesizer::get_problem_size() const {
+        return problem_size_;
+    }
 }
\ No newline at end of file
@@ -4,6 +4,7 @@
 */
 
 #include "SymbolicCompositionalBestEffortSynthesizer.h"
+#include "VariableOrdering.h"
 #include <boost/algorithm/string.hpp>
 #include <queue>
 
@@ -15,51 +16,44 @@ namespace Syft
                                                  std::string environment_specification,
                                                  InputOutputPartition partition,
                                                  Player starting_player,
-                                                 bool dominance_check)    :   var_mgr_(var_mgr),
+                                                 bool dominance_check,
+                                                 SynthesisOptions options)    :   var_mgr_(var_mgr),
                                                                                 agent_specification_(agent_specification),
                                                                                 environment_specification_(environment_specification),
                                                                                 partition_(partition),
                                                                                 starting_player_(starting_player),
-                                                                                dominance_check_(dominance_check)
+                                                                                dominance_check_(dominance_check),
+                                                                                options_(options),
+                                                                                reordering_clock_(var_mgr->cudd_mgr())
     {
         // 1. Step 1. Construct symbolic DFAs formulas {E -> phi, !E, E && phi}
         // Build MONA DFAs for agent and environment specifications
         Syft::Stopwatch ltlf2dfa;
         ltlf2dfa.start();
 
-        ExplicitStateDfaMona agent_spec_dfa =
-            ExplicitStateDfaMona::dfa_of_formula(agent_specification); // DFA A_{phi}
-        ExplicitStateDfaMona environment_spec_dfa =
-            ExplicitStateDfaMona::dfa_of_formula(environment_specification); // DFA A_{E}
-        ExplicitStateDfaMona tautology_dfa =
-            ExplicitStateDfaMona::dfa_of_formula("F(true)"); // DFA A_{tt}. Accepts non-empty traces only
-
-        // DFA A_{phi}
-        // std::cout << std::endl;
-        // std::cout << "Agent goal DFA\n";
-        // agent_spec_dfa.dfa_print();
-        // std::cout << std::endl;
-
-        // DFA A_{E}
-        // std::cout << std::endl;
-        // std::cout << "Environment Specification DFA\n";
-        // environment_spec_dfa.dfa_print();
-        // std::cout << std::endl;
-
-        // tautoloty DFA
-        // std::cout << std::endl;
-        // std::cout << "Tauology DFA\n";
-        // tautology_dfa.dfa_print();
-        // std::cout << std::endl;
+        // If requested, each top-level conjunct gets its own DFA
+        std::pair<std::vector<std::string>, std::vector<std::string>> conjuncts =
+            split_specifications(agent_specification, environment_specification, options_.split_conjunctions);
+        const std::vector<std::string>& agent_conjuncts = conjuncts.first;
+        const std::vector<std::string>& environment_conjuncts = conjuncts.second;
+
+        // DFAs A_{phi_1}, ..., A_{phi_n}, A_{E_1}, ..., A_{E_m} and A_{tt}. A_{tt} accepts non-empty traces only
+        std::vector<ExplicitStateDfaMona> formula_dfas =
+            ExplicitStateDfaMona::dfas_of_formulas(formulas(conjuncts),
+                                                   options_.jobs,
+                                                   options_.dfa_cache_directory);
 
         double t_ltlf2dfa = ltlf2dfa.stop().count() / 1000.0;
-        running_times_.push_back(t_ltlf2dfa);
+        running_times_.push_back(reordering_clock_.exclude(t_ltlf2dfa));
         std::cout << "[BeSyft] LTLf-to-DFA construction DONE in: " << t_ltlf2dfa << " s" << std::endl;
 
         // Obtain parsed formulas (requirement to construct symbolic DFAs)
         Syft::Stopwatch dfa2sym;
         dfa2sym.start();
 
+        if (options_.fit_cache_to_dfas)
+            var_mgr_->fit_cache_to_dfas(ExplicitStateDfaMona::node_count(formula_dfas));
+
         // std::string adversarial_formula = 
             // "(" + environment_specification + ") -> (" + agent_specification +")"; 
 
@@ -68,23 +62,31 @@ namespace Syft
 
         // Extract propositions from formula and partition
         // var_mgr_->create_named_variables(get_props(parsed_adversarial_formula)); // (E -> phi) includes all problem variables
-        var_mgr_->create_named_variables(agent_spec_dfa.names);
-        var_mgr_->create_named_variables(environment_spec_dfa.names);
+        // All named variables are created before any state variable
+        for (const auto& formula_dfa : formula_dfas)
+            var_mgr_->create_named_variables(formula_dfa.names);
         var_mgr_->partition_variables(partition_.input_variables,
                                         partition_.output_variables);
 
-        // Get explicit state DFA from MONA DFA
-        ExplicitStateDfa explicit_agent_dfa =
-            ExplicitStateDfa::from_dfa_mona(var_mgr_, agent_spec_dfa);
-        ExplicitStateDfa explicit_env_dfa =
-            ExplicitStateDfa::from_dfa_mona(var_mgr_, environment_spec_dfa); 
-        ExplicitStateDfa explicit_tau_dfa =
-            ExplicitStateDfa::from_dfa_mona(var_mgr_, tautology_dfa);
-
-        // Get Symbolic State DFA from Explicit DFA
-        symbolic_dfas_.push_back(SymbolicStateDfa::from_explicit(std::move(explicit_agent_dfa)));
-        symbolic_dfas_.push_back(SymbolicStateDfa::from_explicit(std::move(explicit_env_dfa)));
-        symbolic_dfas_.push_back(SymbolicStateDfa::from_explicit(std::move(explicit_tau_dfa)));
+        // Get Symbolic State DFA from Explicit DFA, obtained from MONA DFA
+        std::vector<SymbolicStateDfa> conjunct_dfas;
+        for (const auto& formula_dfa : formula_dfas) {
+            ExplicitStateDfa explicit_dfa =
+                ExplicitStateDfa::from_dfa_mona(var_mgr_, formula_dfa);
+            conjunct_dfas.push_back(SymbolicStateDfa::from_explicit(std::move(explicit_dfa)));
+        }
+
+        // The DFA of a conjunction is the product of the DFAs of its conjuncts
+        auto conjunction_dfa = [](std::vector<SymbolicStateDfa>::const_iterator begin,
+                                  std::vector<SymbolicStateDfa>::const_iterator end) {
+            std::vector<SymbolicStateDfa> dfas(begin, end);
+            return dfas.size() == 1 ? dfas[0] : SymbolicStateDfa::product(dfas);
+        };
+        auto agent_end = conjunct_dfas.cbegin() + agent_conjuncts.size();
+        auto environment_end = agent_end + environment_conjuncts.size();
+        symbolic_dfas_.push_back(conjunction_dfa(conjunct_dfas.cbegin(), agent_end));
+        symbolic_dfas_.push_back(conjunction_dfa(agent_end, environment_end));
+        symbolic_dfas_.push_back(conjunct_dfas.back());
         
         // f_{phi} is stored in symbolic_dfas_[0].final_states()
         // f_{E} is stored in symbolic_dfas_[1].final_states()
@@ -95,9 +97,31 @@ namespace Syft
             SymbolicStateDfa::product(symbolic_dfas_);
         arena_.push_back(arena);
 
+        VariableOrdering variable_ordering(var_mgr_, starting_player_);
+        for (std::size_t i = 0; i < conjunct_dfas.size(); ++i)
+            variable_ordering.add_automaton(conjunct_dfas[i].automaton_id(), formula_dfas[i].names);
+        variable_ordering.apply(options_);
+
         double t_dfa2sym = dfa2sym.stop().count() / 1000.0;
-        running_times_.push_back(t_dfa2sym);
+        running_times_.push_back(reordering_clock_.exclude(t_dfa2sym));
         std::cout << "[BeSyft] Symbolic DFA construction DONE in " << t_dfa2sym << " s" << std::endl;
+        problem_size_ = ProblemSize::of(formula_dfas, arena_[0]);
+    }
+
+    std::vector<std::string> SymbolicCompositionalBestEffortSynthesizer::formulas(const std::string& agent_specification,
+            const std::string& environment_specification,
+            const SynthesisOptions& options) {
+        // If requested, each top-level conjunct gets its own DFA
+        return formulas(split_specifications(agent_specification, environment_specification,
+                                             options.split_conjunctions));
+    }
+
+    std::vector<std::string> SymbolicCompositionalBestEffortSynthesizer::formulas(
+            const std::pair<std::vector<std::string>, std::vector<std::string>>& conjuncts) {
+        std::vector<std::string> conjunct_formulas = conjuncts.first;
+        conjunct_formulas.insert(conjunct_formulas.end(), conjuncts.second.begin(), conjuncts.second.end());
+        conjunct_formulas.push_back("F(true)");
+        return conjunct_formulas;
     }
 
     BestEffortSynthesisResult SymbolicCompositionalBestEffortSynthesizer::run() {
@@ -109,6 +133,17 @@ namespace Syft
         CUDD::BDD neg_goal = ((!symbolic_dfas_[1].final_states()) * (!arena_[0].initial_state_bdd())); // ! f_{E}
         CUDD::BDD coop_goal = (symbolic_dfas_[1].final_states()) * (symbolic_dfas_[0].final_states()) * (!arena_[0].initial_state_bdd()); // F{E} /\ f_{Phi}
 
+        // If requested, the game of step 4 is solved on another thread while the
+        // adversarial game is solved
+        std::unique_ptr<BackgroundReachabilityGame> neg_env_game;
+        if (options_.concurrent_games)
+            neg_env_game = std::make_unique<BackgroundReachabilityGame>(arena_[0],
+                                                                        starting_player_,
+                                                                        Player::Agent,
+                                                                        neg_goal,
+                                                                        var_mgr_->cudd_mgr()->bddOne(),
+                                                                        options_.for_game("negated-environment"));
+
         // Step 3. Compute a winning strategy in the adversarial game
         Stopwatch advGame;
         advGame.start();
@@ -117,23 +152,30 @@ namespace Syft
                                                 starting_player_,
                                                 Player::Agent,
                                                 adv_goal, // Lifting
-                                                var_mgr_->cudd_mgr()->bddOne());
+                                                var_mgr_->cudd_mgr()->bddOne(),
+                                                options_.for_game("adversarial"));
         best_effort_result.adversarial = adv_synthesizer.run();
         double t_advGame = advGame.stop().count() / 1000.0;
-        running_times_.push_back(t_advGame);
+        running_times_.push_back(reordering_clock_.exclude(t_advGame));
         std::cout << "DONE in " << t_advGame << " s" << std::endl;
 
         // Step 4. Compute environment's winning region in negation of environment game
         Stopwatch coopGame;
         coopGame.start();
         std::cout << "[BeSyft] Constructing and solving cooperative game...";
-        ReachabilitySynthesizer neg_env_synthesizer(arena_[0],
-                                                    starting_player_,
-                                                    Player::Agent,  // gets env winning region from agent's
-                                                    neg_goal, // Lifting
-                                                    var_mgr_->cudd_mgr()->bddOne());
-        SynthesisResult env_result = neg_env_synthesizer.run();
-        CUDD::BDD non_environment_winning_region = env_result.winning_states;
+        CUDD::BDD non_environment_winning_region;
+        if (neg_env_game) {
+            non_environment_winning_region = neg_env_game->winning_states();
+        } else {
+            ReachabilitySynthesizer neg_env_synthesizer(arena_[0],
+                                                        starting_player_,
+                                                        Player::Agent,  // gets env winning region from agent's
+                                                        neg_goal, // Lifting
+                                                        var_mgr_->cudd_mgr()->bddOne(),
+                                                        options_.for_game("negated-environment"));
+            SynthesisResult env_result = neg_env_synthesizer.run();
+            non_environment_winning_region = env_result.winning_states;
+        }
 
         // Step 5. Restrict arena to environemt winning region.
         // i.e. all states that are in non_environment_winning_region have to be pruned as invalid
@@ -144,10 +186,11 @@ namespace Syft
                                                             starting_player_,
                                                             Player::Agent,
                                                             coop_goal, // Lifting
-                                                            !non_environment_winning_region); 
+                                                            !non_environment_winning_region,
+                                                            options_.for_game("cooperative")); 
         best_effort_result.cooperative = coop_synthesizer.run();
         double t_coopGame = coopGame.stop().count() / 1000.0;
-        running_times_.push_back(t_coopGame);
+        running_times_.push_back(reordering_clock_.exclude(t_coopGame));
         std::cout << "DONE in " << t_coopGame << " s" << std::endl; 
 
         if (dominance_check_) {
@@ -160,128 +203,33 @@ namespace Syft
                 best_effort_result.dominant = true;
                 double domTest_t = domTest.stop().count() / 1000.0;
                 std::cout << "succeeds. Synthesized best-effort strategy is winning. DONE in " <<  domTest_t << " s" << std::endl;
-                running_times_.push_back(domTest_t);
+                running_times_.push_back(reordering_clock_.exclude(domTest_t));
                 return best_effort_result;
             } else if (!best_effort_result.cooperative.realizability) {
                 best_effort_result.dominant = true;
                 double domTest_t = domTest.stop().count() / 1000.0;
                 std::cout << "succeeds. Synthesized best-effort strategy is losing. DONE in " <<  domTest_t << " s" << std::endl;
-                running_times_.push_back(domTest_t);
+                running_times_.push_back(reordering_clock_.exclude(domTest_t));
                 return best_effort_result;
             }
 
-            // number of state variables
-            int non_state_vars = var_mgr_->get_index_to_name().size();
-
-            // initial state vector
-            std::vector<int> vars_init(non_state_vars, 0);
-            std::vector<int> goal_init = symbolic_dfas_[0].initial_state();
-            std::vector<int> env_init = symbolic_dfas_[1].initial_state();
-            std::vector<int> tau_init = symbolic_dfas_[2].initial_state();
-
-            std::vector<int> initial_state;
-            initial_state.insert(initial_state.end(), vars_init.begin(), vars_init.end());
-            initial_state.insert(initial_state.end(), goal_init.begin(), goal_init.end());
-            initial_state.insert(initial_state.end(), env_init.begin(), env_init.end());
-            initial_state.insert(initial_state.end(), tau_init.begin(), tau_init.end());
-
-            // transition function and regions
-            std::vector<CUDD::BDD> transition_function = arena_[0].transition_function();
-            CUDD::BDD winning_region = best_effort_result.adversarial.winning_states;
-            CUDD::BDD cooperative_region = best_effort_result.cooperative.winning_states;
-            CUDD::BDD cooperative_only_region = cooperative_region * (!winning_region);
-
-            // possible environment choices
-            std::vector<std::vector<int>> env_moves = get_assignments(var_mgr_->input_variable_count());
-
-            // initially, only reached state is the initial state
-            // std::set<std::vector<int>> reached;
-            std::unordered_set<std::vector<int>, VectorHash> reached;
-            std::queue<std::vector<int>> frontier;
-            reached.insert(initial_state);
-            frontier.push(initial_state);
-            std::unordered_set<std::vector<int>, VectorHash> expanded;
-            std::unordered_map<int, std::string> id_to_var = var_mgr_->get_index_to_name(); 
-
-            // cooperative winning strategy
-            std::unordered_map<int, CUDD::BDD> cooperative_output_function 
-                = best_effort_result.cooperative.transducer.get()->get_output_function();
-
-            if (starting_player_ == Player::Agent) {
-
-            // stores all cooperative agent moves
+            // Searches symbolically the states reached with the cooperative strategy
+            // for a witness that no dominant strategy exists
             CUDD::BDD all_cooperative_moves = 
                 get_all_cooperative_moves(arena_[0], 
                 coop_synthesizer.get_winning_states(), 
                 coop_synthesizer.get_winning_moves());
+            DominanceChecker dominance_checker(arena_[0], options_);
+            best_effort_result.dominant = dominance_checker.is_dominant(best_effort_result, all_cooperative_moves);
 
-
-            while (!frontier.empty()){ // forall Z in frontier
-
-                std::vector<int> state = frontier.front();
-                std::vector<int> z_state;
-                z_state.insert(z_state.end(), state.begin() + non_state_vars, state.end());
-                frontier.pop();
-
-                // search symbolically states witnessing no dominant strategy exists
-                CUDD::BDD state_bdd = var_mgr_->state_vector_to_bdd(arena_[0].automaton_id(), z_state);
-                CUDD::BDD cooperative_moves = state_bdd * all_cooperative_moves;
-                CUDD::BDD witness_move = 
-                    cooperative_moves * (!cooperative_moves.CProjection(var_mgr_->output_cube()));
-                if (witness_move != var_mgr_->cudd_mgr()->bddZero()) { // state witnesses no dominant strategy exists
-                    best_effort_result.dominant = false;
-                    double domTest_t = domTest.stop().count() / 1000.0;
-                    std::cout << "failed. Synthesized strategy is best-effort and no dominant strategy exists. DONE in " << domTest_t << " s" << std::endl;
-                    running_times_.push_back(domTest_t);
-                    return best_effort_result;
-                } else { // if current state is not a witness, it should be expanded
-                    std::vector<int> transition = state;
-                    for (int i = 0; i < id_to_var.size(); ++i) { // fixes agent choice
-                        std::string var = id_to_var[i];
-                        int agent_eval;
-                        if (var_mgr_->is_output_variable(var)) {
-                            transition[i] = cooperative_output_function[i].Eval(state.data()).IsOne();
-                        }
-                    }
-
-                    for (const auto& env_choice : env_moves) { // for every environment choice
-
-                        int curr_x = 0;
-
-                        for (int i = 0; i < id_to_var.size(); ++i) {
-                            std::string var = id_to_var[i];
-                            if (var_mgr_->is_input_variable(var)) {
-                                transition[i] = env_choice[curr_x];
-                                curr_x = curr_x + 1;
-                            }
-                        }
-
-                    // construct successor state
-                    std::vector<int> successor_state;
-                    successor_state.insert(successor_state.end(), vars_init.begin(), vars_init.end());
-                    for (const auto& bdd : transition_function) successor_state.push_back(bdd.Eval(transition.data()).IsOne());
-
-                    // add next state to frontier only if cooperative winning and has not been expanded
-                    if (cooperative_only_region.Eval(successor_state.data()).IsOne()) {
-                        reached.insert(successor_state);
-                        if (expanded.find(successor_state) == expanded.end()) {
-                            frontier.push(successor_state);
-                        }
-                    }
-                    expanded.insert(state);
-                    }
-
-                    if (reached == expanded) { // if a fixpoint is reached
-                        best_effort_result.dominant = true;
-                        double domTest_t = domTest.stop().count() / 1000.0;
-                        std::cout << "Synthesized strategy is best-effort and dominant. DONE in " << domTest_t << " s" << std::endl;
-                        running_times_.push_back(domTest_t);
-                        return best_effort_result;
-                    }
-                }
+            double domTest_t = domTest.stop().count() / 1000.0;
+            if (best_effort_result.dominant) {
+                std::cout << "Synthesized strategy is best-effort and dominant. DONE in " << domTest_t << " s" << std::endl;
+            } else {
+                std::cout << "failed. Synthesized strategy is best-effort and no dominant strategy exists. DONE in " << domTest_t << " s" << std::endl;
             }
+            running_times_.push_back(reordering_clock_.exclude(domTest_t));
         }
-    }
     return best_effort_result;
 }
 
@@ -379,7 +327,19 @@ namespace Syft
     }
 
     std::vector<double> SymbolicCompositionalBestEffortSynthesizer::get_running_times() const {
-        return running_times_;
+        std::vector<double> running_times = running_times_;
+        if (reordering_enabled(options_)) {
+            running_times.push_back(reordering_clock_.total());
+        }
+        return running_times;
+    }
+
+    ProblemSize SymbolicCompositionalBestEffortSynthesizer::get_problem_size() const {
+        return problem_size_;
+    }
+
+    StrategyExecutor SymbolicCompositionalBestEffortSynthesizer::strategy_executor(const BestEffortSynthesisResult& best_effort_result) const {
+        return StrategyExecutor(arena_[0], best_effort_result);
     }
 
     void SymbolicCompositionalBestEffortSynthesizer::interactive(
@@ -403,7 +363,15 @@ namespace Syft
 
         CUDD::BDD winning_region = best_effort_result.adversarial.winning_states;
         CUDD::BDD cooperative_region = best_effort_result.cooperative.winning_states;
-        std::unordered_map<int, CUDD::BDD> output_function;
+        // Output and transition functions are fetched once rather than at every step
+        const std::unordered_map<int, CUDD::BDD> adversarial_output_function =
+            best_effort_result.adversarial.transducer.get()->get_output_function();
+        const std::unordered_map<int, CUDD::BDD> cooperative_output_function =
+            best_effort_result.cooperative.transducer.get()->get_output_function();
+        const std::vector<std::vector<CUDD::BDD>> transition_functions = {symbolic_dfas_[0].transition_function(),
+                                                                          symbolic_dfas_[1].transition_function(),
+                                                                          symbolic_dfas_[2].transition_function()};
+        const std::unordered_map<int, CUDD::BDD>* output_function = nullptr;
         std::unordered_map<int, CUDD::BDD> alternative_output_function;
 
         std::unordered_map<int, std::string> id_to_var = var_mgr_->get_index_to_name(); 
@@ -420,10 +388,10 @@ namespace Syft
             bool state_is_witness = false;
             if (winning_region.Eval(state.data()).IsOne()) {
                 std::cout << "[BeSyft][interactive] Agent in winning region uses winning strategy" << std::endl;
-                output_function = best_effort_result.adversarial.transducer.get()->get_output_function();
+                output_function = &adversarial_output_function;
             } else if (cooperative_region.Eval(state.data()).IsOne()) {
                 std::cout << "[BeSyft][interactive] Agent in cooperative region uses cooperative strategy" << std::endl;
-                output_function = best_effort_result.cooperative.transducer.get()->get_output_function();
+                output_function = &cooperative_output_function;
                 // if (dominance_check_ & !best_effort_result.dominant) {
                 //     if (witness_region.Eval(state.data()).IsOne()) {
                 //         state_is_witness = true;
@@ -449,7 +417,7 @@ namespace Syft
                     if (var_mgr_->is_output_variable(var)) {
                         std::cout << "Variable: " << var;
                         std::cout << ". Agent output (0 = false, 1 = true): ";
-                        agent_eval = output_function[i].Eval(state.data()).IsOne();
+                        agent_eval = output_function->at(i).Eval(state.data()).IsOne();
                         std::cout << agent_eval << std::endl;
                         transition[i] = agent_eval;
                     }
@@ -508,7 +476,7 @@ namespace Syft
                     if (var_mgr_->is_output_variable(var)) {
                         std::cout << "Variable: " << var;
                         std::cout << ". Agent output (0 = false, 1 = true): ";
-                        agent_eval = output_function[i].Eval(state.data()).IsOne();
+                        agent_eval = output_function->at(i).Eval(state.data()).IsOne();
                         std::cout << agent_eval << std::endl;
                         transition[i] = agent_eval;
                     }
@@ -538,16 +506,16 @@ namespace Syft
             // successor state
             int curr_state_var = id_to_var.size();
             std::vector<int> new_state = state;
-            for (int i = 0; i < symbolic_dfas_[0].transition_function().size(); ++i) {
-                new_state[curr_state_var] = symbolic_dfas_[0].transition_function()[i].Eval(transition.data()).IsOne();
+            for (int i = 0; i < transition_functions[0].size(); ++i) {
+                new_state[curr_state_var] = transition_functions[0][i].Eval(transition.data()).IsOne();
                 ++curr_state_var;
             }
-            for (int i = 0; i < symbolic_dfas_[1].transition_function().size(); ++i) {
-                new_state[curr_state_var] = symbolic_dfas_[1].transition_function()[i].Eval(transition.data()).IsOne();
+            for (int i = 0; i < transition_functions[1].size(); ++i) {
+                new_state[curr_state_var] = transition_functions[1][i].Eval(transition.data()).IsOne();
                 ++curr_state_var;
             }
-            for (int i = 0; i < symbolic_dfas_[2].transition_function().size(); ++i) {
-                new_state[curr_state_var] = symbolic_dfas_[2].transition_function()[i].Eval(transition.data()).IsOne();
+            for (int i = 0; i < transition_functions[2].size(); ++i) {
+                new_state[curr_state_var] = transition_functions[2][i].Eval(transition.data()).IsOne();
                 ++curr_state_var;
             }
             std::cout << "[BeSyft][interactive] Successor state: ";
@@ -568,19 +536,4 @@ namespace Syft
             }
         }
     }
-    std::vector<std::vector<int>> SymbolicCompositionalBestEffortSynthesizer::get_assignments(int n) const {
-        if (n == 1) return {{0}, {1}};
-
-        std::vector<std::vector<int>> rest = get_assignments(n-1);
-        std::vector<std::vector<int>> appended;
-        for (const auto& v: rest) {
-            std::vector<int> v0 = v;
-            std::vector<int> v1 = v;
-            v0.push_back(0);
-            appended.push_back(v0);
-            v1.push_back(1);
-            appended.push_back(v1);
-        }
-        return appended;
-    }
 }
\ No newline at end of file
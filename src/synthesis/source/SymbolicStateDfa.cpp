@@ -1,5 +1,10 @@
 #include "SymbolicStateDfa.h"
 
+#include <stdexcept>
+
+#include "Serialization.h"
+#include "Tracer.h"
+
 namespace Syft {
 
 SymbolicStateDfa::SymbolicStateDfa(std::shared_ptr<VarMgr> var_mgr)
@@ -99,6 +104,9 @@ std::vector<CUDD::BDD> SymbolicStateDfa::symbolic_transition_function(
 
 SymbolicStateDfa SymbolicStateDfa::from_explicit(
     const ExplicitStateDfa& explicit_dfa) {
+  Tracer::Scope trace("from_explicit", "encoding",
+                      explicit_dfa.var_mgr()->cudd_mgr());
+
   std::shared_ptr<VarMgr> var_mgr = explicit_dfa.var_mgr();
 
   auto count_and_id = create_state_variables(var_mgr,
@@ -182,6 +190,76 @@ void SymbolicStateDfa::dump_dot(const std::string& filename) const {
   var_mgr_->dump_dot(adds, function_labels, filename);
 }
 
+void SymbolicStateDfa::save(const std::string& filename) const {
+  FilePointer file = open_file(filename, "wb");
+
+  std::fprintf(file.get(), "besyft-symbolic-dfa 1\n");
+  var_mgr_->save_variables(file.get());
+
+  std::fprintf(file.get(), "automaton %zu\ninitial %zu", automaton_id_,
+               initial_state_.size());
+  for (int bit : initial_state_) {
+    std::fprintf(file.get(), " %d", bit);
+  }
+  std::fprintf(file.get(), "\n");
+
+  // The final states come first, followed by the transition function
+  std::vector<CUDD::BDD> bdds = {final_states_};
+  bdds.insert(bdds.end(), transition_function_.begin(),
+              transition_function_.end());
+  var_mgr_->save_bdds(bdds, file.get());
+}
+
+SymbolicStateDfa SymbolicStateDfa::load(const std::string& filename) {
+  FilePointer file = open_file(filename, "rb");
+
+  expect_token(file.get(), "besyft-symbolic-dfa");
+  expect_token(file.get(), "1");
+
+  SymbolicStateDfa dfa(VarMgr::load_variables(file.get()));
+
+  expect_token(file.get(), "automaton");
+  dfa.automaton_id_ = read_number(file.get());
+
+  if (dfa.automaton_id_ >= dfa.var_mgr_->automaton_num()) {
+    throw std::runtime_error("Error: unknown automaton ID in " + filename + ".");
+  }
+
+  expect_token(file.get(), "initial");
+  std::size_t bit_count = read_number(file.get());
+  for (std::size_t i = 0; i < bit_count; ++i) {
+    dfa.initial_state_.push_back(read_number(file.get()));
+  }
+
+  std::vector<CUDD::BDD> bdds = dfa.var_mgr_->load_bdds(file.get());
+
+  if (bdds.size() != bit_count + 1) {
+    throw std::runtime_error("Error: wrong number of BDDs in " + filename + ".");
+  }
+
+  dfa.final_states_ = bdds[0];
+  dfa.transition_function_.assign(bdds.begin() + 1, bdds.end());
+
+  return dfa;
+}
+
+SymbolicStateDfa SymbolicStateDfa::transfer(
+    std::shared_ptr<VarMgr> var_mgr) const {
+  CUDD::Cudd& destination = *var_mgr->cudd_mgr();
+
+  SymbolicStateDfa dfa(std::move(var_mgr));
+  dfa.automaton_id_ = automaton_id_;
+  dfa.initial_state_ = initial_state_;
+  dfa.final_states_ = final_states_.Transfer(destination);
+
+  dfa.transition_function_.reserve(transition_function_.size());
+  for (const CUDD::BDD& bit_function : transition_function_) {
+    dfa.transition_function_.push_back(bit_function.Transfer(destination));
+  }
+
+  return dfa;
+}
+
 SymbolicStateDfa SymbolicStateDfa::from_predicates(
     std::shared_ptr<VarMgr> var_mgr,
     std::vector<CUDD::BDD> predicates) {
@@ -200,6 +278,9 @@ SymbolicStateDfa SymbolicStateDfa::from_predicates(
 }
 
 SymbolicStateDfa SymbolicStateDfa::product(const std::vector<SymbolicStateDfa>& dfa_vector) {
+    Tracer::Scope trace("product", "encoding",
+                        std::to_string(dfa_vector.size()) + " DFAs");
+
     if (dfa_vector.size() < 1) {
         throw std::runtime_error("Incorrect usage of automata product");
     }
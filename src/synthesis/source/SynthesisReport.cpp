@@ -0,0 +1,309 @@
+#include "SynthesisReport.h"
+
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+#include <sys/resource.h>
+
+#include "Json.h"
+
+namespace Syft {
+
+ProblemSize ProblemSize::of(const std::vector<ExplicitStateDfaMona>& dfas,
+                            const SymbolicStateDfa& arena) {
+  ProblemSize size;
+
+  for (const ExplicitStateDfaMona& dfa : dfas) {
+    size.dfa_states.push_back(dfa.get_nb_states());
+  }
+
+  std::vector<CUDD::BDD> transition_function = arena.transition_function();
+  size.arena_state_bits = transition_function.size();
+  size.arena_nodes =
+    arena.var_mgr()->cudd_mgr()->SharingSize(transition_function);
+
+  return size;
+}
+
+std::string SynthesisReport::algorithm_name(int algorithm_id) {
+  switch (algorithm_id) {
+    case 1: return "Direct Best-Effort Synthesizer";
+    case 2: return "Compositional-Minimal Best-Effort Synthesizer";
+    case 3: return "Compositional Best-Effort Synthesizer";
+    case 4: return "Compositional-Minimal Reactive Synthesizer";
+    case 5: return "Compositional Reactive Synthesizer";
+    default: return "";
+  }
+}
+
+std::string SynthesisReport::status_name(RunStatus status) {
+  switch (status) {
+    case RunStatus::Completed: return "completed";
+    case RunStatus::TimedOut: return "timeout";
+    case RunStatus::OutOfMemory: return "memout";
+    default: return "error";
+  }
+}
+
+void SynthesisReport::set_result(const BestEffortSynthesisResult& result,
+                                 bool dominance_checked) {
+  best_effort = true;
+
+  if (result.adversarial.realizability) {
+    outcome = Outcome::Adversarial;
+  } else if (result.cooperative.realizability) {
+    outcome = Outcome::Cooperative;
+  } else {
+    outcome = Outcome::Unrealizable;
+  }
+
+  this->dominance_checked = dominance_checked;
+  dominant = dominance_checked && result.dominant;
+  adversarial_winning_nodes = result.adversarial.winning_states.nodeCount();
+  cooperative_winning_nodes = result.cooperative.winning_states.nodeCount();
+}
+
+void SynthesisReport::set_result(const SynthesisResult& result) {
+  best_effort = false;
+  outcome = result.realizability ? Outcome::Adversarial : Outcome::Unrealizable;
+  dominance_checked = false;
+  dominant = false;
+  adversarial_winning_nodes = result.winning_states.nodeCount();
+  cooperative_winning_nodes = 0;
+}
+
+void SynthesisReport::set_phase_times(const std::vector<double>& running_times,
+                                      bool reordering) {
+  std::vector<std::string> phases = {"ltlf2dfa", "dfa2sym", "adversarial_game"};
+
+  if (best_effort) {
+    phases.push_back("cooperative_game");
+    if (dominance_checked) phases.push_back("dominance");
+  }
+  if (reordering) phases.push_back("reordering");
+
+  if (phases.size() != running_times.size()) {
+    throw std::runtime_error("Error: Expected " +
+                             std::to_string(phases.size()) +
+                             " running times, got " +
+                             std::to_string(running_times.size()) + ".");
+  }
+
+  phase_times.clear();
+  for (std::size_t i = 0; i < phases.size(); ++i) {
+    phase_times.emplace_back(phases[i], running_times[i]);
+  }
+}
+
+void SynthesisReport::add_phase_time(const std::string& phase,
+                                     double seconds) {
+  for (auto& phase_time : phase_times) {
+    if (phase_time.first == phase) {
+      phase_time.second += seconds;
+      return;
+    }
+  }
+
+  phase_times.emplace_back(phase, seconds);
+}
+
+void SynthesisReport::set_failure(RunStatus status, double elapsed) {
+  this->status = status;
+  phase_times = {{"incomplete", elapsed}};
+}
+
+void SynthesisReport::set_peak_memory(const CUDD::Cudd& mgr) {
+  rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+
+  peak_live_nodes = mgr.ReadPeakLiveNodeCount();
+  peak_rss_kb = usage.ru_maxrss;
+}
+
+double SynthesisReport::phase_time(const std::string& phase) const {
+  for (const auto& phase_time : phase_times) {
+    if (phase_time.first == phase) return phase_time.second;
+  }
+
+  return -1.0;
+}
+
+double SynthesisReport::total_time() const {
+  double total = 0.0;
+
+  for (const auto& phase_time : phase_times) {
+    total += phase_time.second;
+  }
+
+  return total;
+}
+
+std::string SynthesisReport::to_json() const {
+  static const char* outcomes[] = {"adversarial", "cooperative", "unrealizable"};
+  std::ostringstream out;
+
+  out << "{\"algorithm_id\":" << algorithm_id
+      << ",\"algorithm\":" << json_string(algorithm)
+      << ",\"agent_file\":" << json_string(agent_file)
+      << ",\"environment_file\":" << json_string(environment_file)
+      << ",\"partition_file\":" << json_string(partition_file)
+      << ",\"starting_player\":"
+      << (starting_player == Player::Agent ? "\"agent\"" : "\"environment\"")
+      << ",\"dominance_check\":" << (dominance_check ? "true" : "false")
+      << ",\"best_effort\":" << (best_effort ? "true" : "false")
+      << ",\"status\":" << json_string(status_name(status))
+      << ",\"phases_s\":{";
+  for (std::size_t i = 0; i < phase_times.size(); ++i) {
+    out << (i == 0 ? "" : ",") << json_string(phase_times[i].first) << ":"
+        << phase_times[i].second;
+  }
+  out << "},\"total_s\":" << total_time()
+      << ",\"outcome\":";
+  if (status == RunStatus::Completed) {
+    out << "\"" << outcomes[static_cast<int>(outcome)] << "\"";
+  } else {
+    out << "null";
+  }
+  out << ",\"dominant\":"
+      << (dominance_checked ? (dominant ? "true" : "false") : "null")
+      << ",\"dfa_states\":[";
+  for (std::size_t i = 0; i < problem_size.dfa_states.size(); ++i) {
+    out << (i == 0 ? "" : ",") << problem_size.dfa_states[i];
+  }
+  out << "],\"arena_state_bits\":" << problem_size.arena_state_bits
+      << ",\"arena_nodes\":" << problem_size.arena_nodes
+      << ",\"adversarial_winning_nodes\":" << adversarial_winning_nodes
+      << ",\"cooperative_winning_nodes\":";
+  if (best_effort) out << cooperative_winning_nodes; else out << "null";
+  out << ",\"peak_live_nodes\":" << peak_live_nodes
+      << ",\"peak_rss_kb\":" << peak_rss_kb
+      << ",\"cudd\":"
+      << (cudd_statistics ? cudd_statistics->to_json() : "null")
+      << "}";
+
+  return out.str();
+}
+
+std::string SynthesisReport::to_csv() const {
+  std::ostringstream out;
+
+  out << algorithm << "," << agent_file << "," << environment_file << ","
+      << (starting_player == Player::Agent ? "Agent" : "Environment");
+
+  for (const char* phase : {"ltlf2dfa", "dfa2sym", "adversarial_game",
+                            "cooperative_game", "dominance"}) {
+    double time = phase_time(phase);
+    if (time < 0) out << ",NA"; else out << "," << time;
+  }
+  out << "," << total_time();
+
+  if (status != RunStatus::Completed) {
+    static const char* labels[] = {"", ",Timeout,NA", ",Memout,NA", ",Error,NA"};
+    out << labels[static_cast<int>(status)];
+    return out.str();
+  }
+
+  // Reproduces the labels of earlier versions, where an unchecked dominance
+  // is reported as Dom unless the agent wins only cooperatively
+  if (outcome == Outcome::Adversarial) {
+    out << ",Adv";
+  } else if (outcome == Outcome::Cooperative) {
+    out << ",Coop";
+  } else {
+    out << (best_effort ? ",Unr" : ",NoAdv");
+  }
+
+  if (dominance_checked) {
+    out << (dominant ? ",Dom" : ",NoDom");
+  } else if (outcome == Outcome::Cooperative ||
+             (!best_effort && outcome == Outcome::Unrealizable)) {
+    out << ",NA";
+  } else {
+    out << ",Dom";
+  }
+
+  return out.str();
+}
+
+std::string SynthesisReport::job_key() const {
+  return algorithm + "," + agent_file + "," + environment_file + "," +
+    (starting_player == Player::Agent ? "Agent" : "Environment") + "," +
+    partition_file + (dominance_check ? ",DomCheck" : ",NoDomCheck");
+}
+
+std::string SynthesisReport::job_key(const std::string& line) {
+  std::string starting_player = json_string_field(line, "starting_player");
+  bool dominance_check =
+    line.find("\"dominance_check\":true") != std::string::npos;
+
+  return json_string_field(line, "algorithm") + "," +
+    json_string_field(line, "agent_file") + "," +
+    json_string_field(line, "environment_file") + "," +
+    (starting_player == "agent" ? "Agent" : "Environment") + "," +
+    json_string_field(line, "partition_file") +
+    (dominance_check ? ",DomCheck" : ",NoDomCheck");
+}
+
+std::string SynthesisReport::jobs_filename(const std::string& filename) {
+  return filename + ".jobs";
+}
+
+std::unordered_set<std::string> SynthesisReport::saved_job_keys(
+    const std::string& filename) {
+  std::unordered_set<std::string> keys;
+  std::string line;
+
+  // JSON rows carry their key, CSV rows have it in the jobs file
+  std::ifstream results(filename);
+  while (std::getline(results, line)) {
+    if (!line.empty() && line[0] == '{') keys.insert(job_key(line));
+  }
+
+  std::ifstream jobs(jobs_filename(filename));
+  while (std::getline(jobs, line)) {
+    if (!line.empty()) keys.insert(line);
+  }
+
+  return keys;
+}
+
+void SynthesisReport::append_key_to(const std::string& filename) const {
+  std::ofstream out(jobs_filename(filename), std::ios::app);
+
+  if (!out) {
+    throw std::runtime_error("Error: could not open " +
+                             jobs_filename(filename) + ".");
+  }
+
+  out << job_key() << std::endl;
+}
+
+void SynthesisReport::append_cudd_statistics_to(
+    const std::string& filename) const {
+  if (!cudd_statistics) return;
+
+  std::ofstream out(filename + ".cudd", std::ios::app);
+
+  if (!out) {
+    throw std::runtime_error("Error: could not open " + filename + ".cudd.");
+  }
+
+  out << "{\"job\":" << json_string(job_key())
+      << ",\"cudd\":" << cudd_statistics->to_json() << "}" << std::endl;
+}
+
+void SynthesisReport::append_to(const std::string& filename,
+                                ResultsFormat format) const {
+  std::ofstream out(filename, std::ios::app);
+
+  if (!out) {
+    throw std::runtime_error("Error: could not open " + filename + ".");
+  }
+
+  out << (format == ResultsFormat::Csv ? to_csv() : to_json()) << std::endl;
+
+  if (format == ResultsFormat::Csv) append_key_to(filename);
+}
+
+}
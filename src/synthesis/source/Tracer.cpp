@@ -0,0 +1,143 @@
+#include "Tracer.h"
+
+#include <fstream>
+#include <stdexcept>
+#include <thread>
+
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include "Json.h"
+
+namespace Syft {
+
+namespace {
+// CPU time of the calling thread, so that scopes on concurrent threads do not
+// count each other's time. Falls back to the whole process where per-thread
+// usage is not available.
+long long cpu_time_us() {
+  rusage usage;
+#ifdef RUSAGE_THREAD
+  getrusage(RUSAGE_THREAD, &usage);
+#else
+  getrusage(RUSAGE_SELF, &usage);
+#endif
+  return (usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000000LL +
+    usage.ru_utime.tv_usec + usage.ru_stime.tv_usec;
+}
+
+long peak_rss_kb() {
+  rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return usage.ru_maxrss;
+}
+}
+
+Tracer::Tracer()
+    : enabled_(false)
+    , origin_(Clock::now())
+{}
+
+Tracer& Tracer::instance() {
+  static Tracer tracer;
+  return tracer;
+}
+
+void Tracer::enable() {
+  origin_ = Clock::now();
+  enabled_ = true;
+}
+
+bool Tracer::enabled() const {
+  return enabled_;
+}
+
+void Tracer::record(Event event) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  event.thread = thread_numbers_.emplace(event.thread_id,
+                                         thread_numbers_.size() + 1).first->second;
+  events_.push_back(std::move(event));
+}
+
+void Tracer::write(const std::string& filename) const {
+  std::ofstream out(filename);
+
+  if (!out) {
+    throw std::runtime_error("Error: could not open " + filename + ".");
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  int pid = getpid();
+
+  out.precision(17);
+  out << "{\"traceEvents\":[";
+  for (std::size_t i = 0; i < events_.size(); ++i) {
+    const Event& event = events_[i];
+
+    out << (i == 0 ? "\n" : ",\n")
+        << "{\"name\":" << json_string(event.name)
+        << ",\"cat\":" << json_string(event.category)
+        << ",\"ph\":\"X\""
+        << ",\"ts\":" << event.start_us
+        << ",\"dur\":" << event.duration_us
+        << ",\"pid\":" << pid
+        << ",\"tid\":" << event.thread
+        << ",\"args\":{\"cpu_us\":" << event.cpu_us
+        << ",\"peak_rss_kb\":" << event.peak_rss_kb;
+    for (const auto& counter : event.counters) {
+      out << ",\"" << counter.first << "\":" << counter.second;
+    }
+    if (!event.detail.empty()) {
+      out << ",\"detail\":" << json_string(event.detail);
+    }
+    out << "}}";
+  }
+  out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+Tracer::Scope::Scope(std::string name, std::string category,
+                     std::string detail)
+    : active_(Tracer::instance().enabled()) {
+  if (!active_) return;
+
+  name_ = std::move(name);
+  category_ = std::move(category);
+  detail_ = std::move(detail);
+  cpu_start_us_ = cpu_time_us();
+  start_ = Clock::now();
+}
+
+Tracer::Scope::Scope(std::string name, std::string category,
+                     std::shared_ptr<CUDD::Cudd> cudd_mgr, std::string detail)
+    : Scope(std::move(name), std::move(category), std::move(detail)) {
+  if (!active_) return;
+
+  cudd_mgr_ = std::move(cudd_mgr);
+  cudd_start_ = CuddStatistics::of(*cudd_mgr_);
+}
+
+Tracer::Scope::~Scope() {
+  if (!active_) return;
+
+  Clock::time_point end = Clock::now();
+  Tracer& tracer = Tracer::instance();
+
+  Event event;
+  event.name = std::move(name_);
+  event.category = std::move(category_);
+  event.detail = std::move(detail_);
+  event.start_us = std::chrono::duration_cast<std::chrono::microseconds>(
+      start_ - tracer.origin_).count();
+  event.duration_us = std::chrono::duration_cast<std::chrono::microseconds>(
+      end - start_).count();
+  event.cpu_us = cpu_time_us() - cpu_start_us_;
+  event.peak_rss_kb = peak_rss_kb();
+  event.thread_id = std::this_thread::get_id();
+  if (cudd_mgr_) {
+    event.counters = CuddStatistics::of(*cudd_mgr_).since(cudd_start_).values();
+  }
+
+  tracer.record(std::move(event));
+}
+
+}
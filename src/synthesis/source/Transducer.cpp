@@ -1,7 +1,13 @@
 #include "Transducer.h"
 
+#include <cassert>
+#include <cstdlib>
 #include <cstring>
 #include <iostream>
+#include <stdexcept>
+
+#include "Serialization.h"
+#include "Tracer.h"
 
 namespace Syft {
 
@@ -43,4 +49,157 @@ void Transducer::dump_dot(const std::string& filename) const {
 
   var_mgr_->dump_dot(output_vector, output_labels, filename);
   }
+
+std::shared_ptr<VarMgr> Transducer::var_mgr() const {
+  return var_mgr_;
+}
+
+void Transducer::save(const std::string& filename) const {
+  FilePointer file = open_file(filename, "wb");
+
+  std::fprintf(file.get(), "besyft-transducer 1\n");
+  var_mgr_->save_variables(file.get());
+
+  std::fprintf(file.get(), "players %d %d\ninitial %zu",
+               static_cast<int>(starting_player_),
+               static_cast<int>(protagonist_player_),
+               initial_vector_.size());
+  for (int bit : initial_vector_) {
+    std::fprintf(file.get(), " %d", bit);
+  }
+
+  // The output function comes first, in the order of the indices listed
+  // here, followed by the transition function
+  std::vector<CUDD::BDD> bdds;
+  std::fprintf(file.get(), "\noutputs %zu", output_function_.size());
+  for (const auto& index_and_function : output_function_) {
+    std::fprintf(file.get(), " %d", index_and_function.first);
+    bdds.push_back(index_and_function.second);
+  }
+  std::fprintf(file.get(), "\n");
+
+  bdds.insert(bdds.end(), transition_function_.begin(),
+              transition_function_.end());
+  var_mgr_->save_bdds(bdds, file.get());
+}
+
+Transducer Transducer::load(const std::string& filename) {
+  FilePointer file = open_file(filename, "rb");
+
+  expect_token(file.get(), "besyft-transducer");
+  expect_token(file.get(), "1");
+
+  std::shared_ptr<VarMgr> var_mgr = VarMgr::load_variables(file.get());
+
+  auto read_player = [&file]() {
+    return read_number(file.get()) == static_cast<std::size_t>(Player::Agent) ?
+      Player::Agent : Player::Environment;
+  };
+
+  expect_token(file.get(), "players");
+  Player starting_player = read_player();
+  Player protagonist_player = read_player();
+
+  expect_token(file.get(), "initial");
+  std::size_t bit_count = read_number(file.get());
+  std::vector<int> initial_vector;
+  for (std::size_t i = 0; i < bit_count; ++i) {
+    initial_vector.push_back(read_number(file.get()));
+  }
+
+  expect_token(file.get(), "outputs");
+  std::size_t output_count = read_number(file.get());
+  std::vector<int> output_indices;
+  for (std::size_t i = 0; i < output_count; ++i) {
+    output_indices.push_back(read_number(file.get()));
+  }
+
+  std::vector<CUDD::BDD> bdds = var_mgr->load_bdds(file.get());
+
+  if (bdds.size() < output_count) {
+    throw std::runtime_error("Error: wrong number of BDDs in " + filename + ".");
+  }
+
+  std::unordered_map<int, CUDD::BDD> output_function;
+  for (std::size_t i = 0; i < output_count; ++i) {
+    output_function[output_indices[i]] = bdds[i];
+  }
+
+  std::vector<CUDD::BDD> transition_function(bdds.begin() + output_count,
+                                             bdds.end());
+
+  return Transducer(var_mgr, std::move(initial_vector),
+                    std::move(output_function), std::move(transition_function),
+                    starting_player, protagonist_player);
+}
+
+std::unique_ptr<Transducer> Transducer::from_winning_moves(
+    std::shared_ptr<VarMgr> var_mgr,
+    std::vector<int> initial_vector,
+    const CUDD::BDD& winning_moves,
+    std::vector<CUDD::BDD> transition_function,
+    Player starting_player,
+    Player protagonist_player,
+    bool verify) {
+  Tracer::Scope trace("synthesize_strategy", "strategy", var_mgr->cudd_mgr());
+
+  std::vector<CUDD::BDD> parameterized_output_function;
+  int* output_indices;
+  CUDD::BDD output_cube = var_mgr->output_cube();
+  std::size_t output_count = var_mgr->output_variable_count();
+
+  // Need to negate the BDD because b.SolveEqn(...) solves the equation b = 0
+  CUDD::BDD pre = (!winning_moves).SolveEqn(output_cube,
+					    parameterized_output_function,
+					    &output_indices,
+					    output_count);
+
+  // Copy the index since it will be necessary in the last step
+  std::vector<int> index_copy(output_count);
+
+  for (std::size_t i = 0; i < output_count; ++i) {
+    index_copy[i] = output_indices[i];
+  }
+
+  if (verify) {
+    // Verify that the solution is correct, also frees output_index
+    CUDD::BDD verified = (!winning_moves).VerifySol(parameterized_output_function,
+                                                    output_indices);
+
+    assert(pre == verified);
+  } else {
+    std::free(output_indices);
+  }
+
+  std::unordered_map<int, CUDD::BDD> output_function;
+  
+  // Let y_i be the i-th output variable in the BDD ordering. The parameterized
+  // output function for y_i is of the form f_i(x_1, ..., x_m, p_i, ..., p_n)
+  // where p_i, ..., p_n are parameters taking the place of y_i, ..., y_n. All
+  // f_i are such that no matter what we replace p_i, ..., p_n with, the result
+  // is a valid output function. We replace the parameters with 1 so that all
+  // f_i are dependent only on the input and state variables.
+  for (int i = output_count - 1; i >= 0; --i) {
+      int output_index = index_copy[i];
+
+      output_function[output_index] = parameterized_output_function[i];
+
+      // TODO(Lucas): Replace inner loop with CUDD::BDD::VectorCompose
+      for (int j = output_count - 1; j >= i; --j) {
+          int parameter_index = index_copy[j];
+
+	  // Can be anything, set to the constant 1 for simplicity
+	  CUDD::BDD parameter_value = var_mgr->cudd_mgr()->bddOne();
+
+	  output_function[output_index] =
+	    output_function[output_index].Compose(parameter_value,
+						  parameter_index);
+      }
+  }
+
+  return std::make_unique<Transducer>(
+      std::move(var_mgr), std::move(initial_vector), std::move(output_function),
+      std::move(transition_function), starting_player, protagonist_player);
+}
+
 }
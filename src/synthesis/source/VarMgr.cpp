@@ -1,14 +1,90 @@
 #include "VarMgr.h"
 
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
 #include <cstring>
+#include <set>
 #include <stdexcept>
 #include <boost/algorithm/string.hpp>
 #include <iostream>
 
+#include "dddmp.h"
+#include "Serialization.h"
+
 namespace Syft {
 
-VarMgr::VarMgr() {
-  mgr_ = std::make_shared<CUDD::Cudd>();
+namespace {
+
+// The smallest power of two at least n, within [min, max]
+unsigned int power_of_two_slots(std::size_t n, unsigned int min,
+                                unsigned int max) {
+  unsigned int slots = min;
+  while (slots < n && slots < max) {
+    slots *= 2;
+  }
+  return slots;
+}
+
+}
+
+CuddResources CuddResources::fitted_to_dfas(std::size_t dfa_node_count) const {
+  CuddResources resources = *this;
+
+  // Each state bit of the encoding gets a subtable holding a fraction of the
+  // DFA's BDD nodes, and each operation on it caches a few results per node
+  if (resources.unique_slots == 0) {
+    resources.unique_slots = power_of_two_slots(dfa_node_count / 8, 64, 1u << 16);
+  }
+  if (resources.cache_slots == 0) {
+    resources.cache_slots = power_of_two_slots(4 * dfa_node_count, 1u << 12,
+                                               1u << 22);
+  }
+
+  return resources;
+}
+
+VarMgr::VarMgr(const CuddResources& resources) : resources_(resources) {
+  mgr_ = std::make_shared<CUDD::Cudd>(
+      0, 0,
+      resources.unique_slots > 0 ? resources.unique_slots : CUDD_UNIQUE_SLOTS,
+      resources.cache_slots > 0 ? resources.cache_slots : CUDD_CACHE_SLOTS,
+      resources.max_memory);
+
+  if (resources.max_memory > 0) {
+    mgr_->SetMaxMemory(resources.max_memory);
+  }
+
+  if (resources.max_cache_hard > 0) {
+    mgr_->SetMaxCacheHard(resources.max_cache_hard);
+  }
+
+  if (resources.loose_up_to > 0) {
+    mgr_->SetLooseUpTo(resources.loose_up_to);
+  }
+
+  if (!resources.garbage_collection) {
+    mgr_->DisableGarbageCollection();
+  }
+}
+
+void VarMgr::fit_cache_to_dfas(std::size_t dfa_node_count) {
+  // Every state bit of the encoding is a function of the DFA's BDD nodes, and
+  // each operation on it caches a few results per node
+  std::size_t cache_slots = 1;
+  while (cache_slots < 16 * dfa_node_count && cache_slots < (1u << 26)) {
+    cache_slots *= 2;
+  }
+
+  if (cache_slots > mgr_->ReadMaxCacheHard()) {
+    mgr_->SetMaxCacheHard(cache_slots);
+  }
+
+  std::size_t loose_up_to = std::min<std::size_t>(64 * dfa_node_count,
+                                                   1u << 28);
+  if (loose_up_to > mgr_->ReadLooseUpTo()) {
+    mgr_->SetLooseUpTo(loose_up_to);
+  }
 }
 
 void VarMgr::print_varmgr() const {
@@ -125,6 +201,36 @@ CUDD::BDD VarMgr::state_variable(std::size_t automaton_id, std::size_t i)
     const {
   return state_variables_[automaton_id][i];
 }
+
+std::vector<CUDD::BDD> VarMgr::state_variables(std::size_t automaton_id)
+    const {
+  return state_variables_[automaton_id];
+}
+
+void VarMgr::create_next_state_variables(std::size_t automaton_id) {
+  for (const CUDD::BDD& variable : state_variables_[automaton_id]) {
+    int index = variable.NodeReadIndex();
+
+    if (next_state_variables_.find(index) == next_state_variables_.end()) {
+      // Creates the new variable right below the state variable, so that
+      // relations between them stay small
+      int level = mgr_->ReadPerm(index);
+      next_state_variables_[index] = mgr_->bddNewVarAtLevel(level + 1);
+    }
+  }
+}
+
+std::vector<CUDD::BDD> VarMgr::next_state_variables(std::size_t automaton_id)
+    const {
+  std::vector<CUDD::BDD> variables;
+  variables.reserve(state_variables_[automaton_id].size());
+
+  for (const CUDD::BDD& variable : state_variables_[automaton_id]) {
+    variables.push_back(next_state_variables_.at(variable.NodeReadIndex()));
+  }
+
+  return variables;
+}
   
 CUDD::BDD VarMgr::state_vector_to_bdd(std::size_t automaton_id,
 				      const std::vector<int>& state_vector)
@@ -168,6 +274,170 @@ void VarMgr::partition_variables(const std::vector<std::string>& input_names,
   }
 }
 
+std::vector<int> VarMgr::variable_order() const {
+  std::vector<int> order;
+  order.reserve(mgr_->ReadSize());
+
+  for (int level = 0; level < mgr_->ReadSize(); ++level) {
+    order.push_back(mgr_->ReadInvPerm(level));
+  }
+
+  return order;
+}
+
+void VarMgr::set_variable_order(const std::vector<int>& order) {
+  std::vector<bool> seen(mgr_->ReadSize(), false);
+
+  for (int index : order) {
+    if (index < 0 || index >= mgr_->ReadSize() || seen[index]) {
+      throw std::runtime_error(
+          "Error: A variable order must be a permutation of all variables.");
+    }
+    seen[index] = true;
+  }
+
+  if (order.size() != seen.size()) {
+    throw std::runtime_error(
+        "Error: A variable order must be a permutation of all variables.");
+  }
+
+  std::vector<int> permutation = order;
+  mgr_->ShuffleHeap(permutation.data());
+}
+
+namespace {
+// Splits a label into its text with every number replaced by '#', and the
+// numbers, so that labels differing only in numbers have the same stem
+std::pair<std::string, std::vector<long>> split_label(const std::string& label) {
+  std::string stem;
+  std::vector<long> numbers;
+
+  for (std::size_t i = 0; i < label.size(); ) {
+    if (std::isdigit(static_cast<unsigned char>(label[i]))) {
+      std::size_t end = i;
+      while (end < label.size() &&
+             std::isdigit(static_cast<unsigned char>(label[end]))) {
+        ++end;
+      }
+      numbers.push_back(std::stol(label.substr(i, end - i)));
+      stem += '#';
+      i = end;
+    } else {
+      stem += label[i++];
+    }
+  }
+
+  return {stem, numbers};
+}
+}
+
+void VarMgr::save_variable_order(FILE* file) const {
+  std::vector<std::string> labels = variable_labels();
+
+  std::fprintf(file, "order %d\n", mgr_->ReadSize());
+  for (int level = 0; level < mgr_->ReadSize(); ++level) {
+    std::fprintf(file, "%s\n", labels[mgr_->ReadInvPerm(level)].c_str());
+  }
+}
+
+std::vector<int> VarMgr::read_variable_order(FILE* file) const {
+  expect_token(file, "order");
+  std::size_t saved_count = read_number(file);
+
+  std::vector<std::string> saved_labels;
+  saved_labels.reserve(saved_count);
+  for (std::size_t i = 0; i < saved_count; ++i) {
+    saved_labels.push_back(read_token(file));
+  }
+
+  std::vector<std::string> labels = variable_labels();
+  std::unordered_map<std::string, int> label_to_index;
+  for (std::size_t index = 0; index < labels.size(); ++index) {
+    label_to_index[labels[index]] = index;
+  }
+
+  std::unordered_map<std::string, std::size_t> saved_positions;
+  for (std::size_t i = 0; i < saved_labels.size(); ++i) {
+    saved_positions[saved_labels[i]] = i;
+  }
+
+  // Attaches each variable missing from the file to the saved variable with
+  // the same stem and the largest numbers below its own
+  std::vector<std::vector<int>> attached(saved_labels.size());
+  std::vector<int> unattached;
+
+  for (int level = 0; level < mgr_->ReadSize(); ++level) {
+    int index = mgr_->ReadInvPerm(level);
+    if (saved_positions.count(labels[index]) > 0) continue;
+
+    auto stem_and_numbers = split_label(labels[index]);
+    std::size_t anchor = saved_labels.size();
+    std::vector<long> anchor_numbers;
+
+    for (std::size_t i = 0; i < saved_labels.size(); ++i) {
+      auto saved_stem_and_numbers = split_label(saved_labels[i]);
+
+      if (saved_stem_and_numbers.first == stem_and_numbers.first &&
+          saved_stem_and_numbers.second < stem_and_numbers.second &&
+          (anchor == saved_labels.size() ||
+           anchor_numbers < saved_stem_and_numbers.second)) {
+        anchor = i;
+        anchor_numbers = saved_stem_and_numbers.second;
+      }
+    }
+
+    if (anchor < saved_labels.size()) {
+      attached[anchor].push_back(index);
+    } else {
+      unattached.push_back(index);
+    }
+  }
+
+  std::vector<int> order;
+  order.reserve(mgr_->ReadSize());
+
+  for (std::size_t i = 0; i < saved_labels.size(); ++i) {
+    auto it = label_to_index.find(saved_labels[i]);
+    if (it != label_to_index.end()) {
+      order.push_back(it->second);
+    }
+
+    // Among variables attached to the same one, smaller numbers go first
+    std::stable_sort(attached[i].begin(), attached[i].end(),
+                     [&](int a, int b) {
+                       return split_label(labels[a]).second <
+                         split_label(labels[b]).second;
+                     });
+    order.insert(order.end(), attached[i].begin(), attached[i].end());
+  }
+
+  order.insert(order.end(), unattached.begin(), unattached.end());
+
+  return order;
+}
+
+void VarMgr::group_state_variables(std::size_t automaton_id) {
+  if (state_variables_[automaton_id].empty()) return;
+
+  int top_level = mgr_->ReadSize();
+  int bottom_level = -1;
+
+  for (const CUDD::BDD& variable : state_variables_[automaton_id]) {
+    int level = mgr_->ReadPerm(variable.NodeReadIndex());
+    top_level = std::min(top_level, level);
+    bottom_level = std::max(bottom_level, level);
+  }
+
+  std::size_t size = bottom_level - top_level + 1;
+
+  if (size != state_variables_[automaton_id].size()) {
+    throw std::runtime_error(
+        "Error: Only state variables at adjacent levels can be grouped.");
+  }
+
+  mgr_->MakeTreeNode(mgr_->ReadInvPerm(top_level), size, MTR_DEFAULT);
+}
+
 std::shared_ptr<CUDD::Cudd> VarMgr::cudd_mgr() const {
   return mgr_;
 }
@@ -181,7 +451,8 @@ std::string VarMgr::index_to_name(int index) const {
 }
 
 std::size_t VarMgr::total_variable_count() const {
-  return name_to_variable_.size() + total_state_variable_count();
+  return name_to_variable_.size() + total_state_variable_count() +
+    next_state_variables_.size();
 }
   
 std::size_t VarMgr::total_state_variable_count() const {
@@ -235,6 +506,12 @@ std::vector<CUDD::BDD> VarMgr::make_compose_vector(
     compose_vector[index] = variable;
   }
 
+  // Next-state variables get mapped to the variable itself
+  for (const auto& index_and_variable : next_state_variables_) {
+    compose_vector[index_and_variable.second.NodeReadIndex()] =
+      index_and_variable.second;
+  }
+
   // State variables for other automaton ids get mapped to the variable itself
   
   for (std::size_t id = 0; id < automaton_id; ++id) {
@@ -288,6 +565,11 @@ std::vector<std::string> VarMgr::variable_labels() const {
       labels[index] = "A" + std::to_string(id) + ":Z" + std::to_string(i);
     }
   }
+
+  for (const auto& index_and_variable : next_state_variables_) {
+    std::size_t index = index_and_variable.second.NodeReadIndex();
+    labels[index] = labels[index_and_variable.first] + "'";
+  }
   //std::cout << "constructing state vars... done" << std::endl;
 
   return labels;
@@ -395,4 +677,223 @@ std::size_t VarMgr::copy_state_variables(std::size_t automaton_id) {
   return copied_vars_id;
 }
   
+void VarMgr::save_variables(FILE* file) const {
+  std::fprintf(file, "variables %d\n", mgr_->ReadSize());
+
+  std::fprintf(file, "named %zu\n", index_to_name_.size());
+  for (const auto& index_and_name : index_to_name_) {
+    std::fprintf(file, "%d %s\n", index_and_name.first,
+                 index_and_name.second.c_str());
+  }
+
+  std::fprintf(file, "inputs %zu", input_variables_.size());
+  for (const std::string& label : input_variable_labels()) {
+    std::fprintf(file, " %s", label.c_str());
+  }
+
+  std::fprintf(file, "\noutputs %zu", output_variables_.size());
+  for (const std::string& label : output_variable_labels()) {
+    std::fprintf(file, " %s", label.c_str());
+  }
+
+  std::fprintf(file, "\nautomata %zu\n", state_variables_.size());
+  for (const auto& variables : state_variables_) {
+    std::fprintf(file, "%zu", variables.size());
+    for (const CUDD::BDD& variable : variables) {
+      std::fprintf(file, " %u", variable.NodeReadIndex());
+    }
+    std::fprintf(file, "\n");
+  }
+
+  std::fprintf(file, "next %zu\n", next_state_variables_.size());
+  for (const auto& index_and_variable : next_state_variables_) {
+    std::fprintf(file, "%d %u\n", index_and_variable.first,
+                 index_and_variable.second.NodeReadIndex());
+  }
+
+  // The index of the variable at each level, top to bottom
+  std::fprintf(file, "order");
+  for (int level = 0; level < mgr_->ReadSize(); ++level) {
+    std::fprintf(file, " %d", mgr_->ReadInvPerm(level));
+  }
+  std::fprintf(file, "\n");
+}
+
+std::shared_ptr<VarMgr> VarMgr::load_variables(FILE* file) {
+  std::shared_ptr<VarMgr> var_mgr = std::make_shared<VarMgr>();
+
+  expect_token(file, "variables");
+  std::size_t variable_count = read_number(file);
+
+  auto read_index = [file, variable_count]() {
+    std::size_t index = read_number(file);
+    if (index >= variable_count) {
+      throw std::runtime_error("Error: variable index " + std::to_string(index) +
+                               " out of range.");
+    }
+    return static_cast<int>(index);
+  };
+
+  // Creates the variables in index order, so that each gets its saved index
+  for (std::size_t i = 0; i < variable_count; ++i) {
+    var_mgr->mgr_->bddVar(i);
+  }
+
+  expect_token(file, "named");
+  std::size_t named_count = read_number(file);
+  for (std::size_t i = 0; i < named_count; ++i) {
+    int index = read_index();
+    std::string name = read_token(file);
+    var_mgr->name_to_variable_[name] = var_mgr->mgr_->bddVar(index);
+    var_mgr->index_to_name_[index] = name;
+  }
+
+  expect_token(file, "inputs");
+  std::size_t input_count = read_number(file);
+  for (std::size_t i = 0; i < input_count; ++i) {
+    var_mgr->input_variables_.push_back(
+        var_mgr->name_to_variable(read_token(file)));
+  }
+
+  expect_token(file, "outputs");
+  std::size_t output_count = read_number(file);
+  for (std::size_t i = 0; i < output_count; ++i) {
+    var_mgr->output_variables_.push_back(
+        var_mgr->name_to_variable(read_token(file)));
+  }
+
+  // Product and copied automata share variables with their components
+  std::set<int> state_indices;
+  expect_token(file, "automata");
+  std::size_t automaton_count = read_number(file);
+  for (std::size_t id = 0; id < automaton_count; ++id) {
+    std::size_t state_count = read_number(file);
+    var_mgr->state_variables_.emplace_back();
+    for (std::size_t i = 0; i < state_count; ++i) {
+      int index = read_index();
+      var_mgr->state_variables_[id].push_back(var_mgr->mgr_->bddVar(index));
+      state_indices.insert(index);
+    }
+  }
+  var_mgr->state_variable_count_ = state_indices.size();
+
+  expect_token(file, "next");
+  std::size_t next_count = read_number(file);
+  for (std::size_t i = 0; i < next_count; ++i) {
+    int index = read_index();
+    var_mgr->next_state_variables_[index] =
+      var_mgr->mgr_->bddVar(read_index());
+  }
+
+  expect_token(file, "order");
+  std::vector<int> order(variable_count);
+  for (std::size_t level = 0; level < variable_count; ++level) {
+    order[level] = read_index();
+  }
+  var_mgr->mgr_->ShuffleHeap(order.data());
+
+  return var_mgr;
+}
+
+std::shared_ptr<VarMgr> VarMgr::copy() const {
+  std::shared_ptr<VarMgr> var_mgr = std::make_shared<VarMgr>(resources_);
+
+  // Creates the variables in index order, so that each keeps its index
+  for (int i = 0; i < mgr_->ReadSize(); ++i) {
+    var_mgr->mgr_->bddVar(i);
+  }
+
+  auto copy_variable = [&var_mgr](const CUDD::BDD& variable) {
+    return var_mgr->mgr_->bddVar(variable.NodeReadIndex());
+  };
+
+  var_mgr->index_to_name_ = index_to_name_;
+  for (const auto& name_and_variable : name_to_variable_) {
+    var_mgr->name_to_variable_[name_and_variable.first] =
+      copy_variable(name_and_variable.second);
+  }
+
+  for (const CUDD::BDD& variable : input_variables_) {
+    var_mgr->input_variables_.push_back(copy_variable(variable));
+  }
+
+  for (const CUDD::BDD& variable : output_variables_) {
+    var_mgr->output_variables_.push_back(copy_variable(variable));
+  }
+
+  for (const auto& variables : state_variables_) {
+    var_mgr->state_variables_.emplace_back();
+    for (const CUDD::BDD& variable : variables) {
+      var_mgr->state_variables_.back().push_back(copy_variable(variable));
+    }
+  }
+  var_mgr->state_variable_count_ = state_variable_count_;
+
+  for (const auto& index_and_variable : next_state_variables_) {
+    var_mgr->next_state_variables_[index_and_variable.first] =
+      copy_variable(index_and_variable.second);
+  }
+
+  std::vector<int> order = variable_order();
+  var_mgr->mgr_->ShuffleHeap(order.data());
+
+  if (mgr_->TimeLimited()) {
+    var_mgr->mgr_->SetStartTime(mgr_->ReadStartTime());
+    var_mgr->mgr_->SetTimeLimit(mgr_->ReadTimeLimit());
+  }
+
+  return var_mgr;
+}
+
+void VarMgr::save_bdds(const std::vector<CUDD::BDD>& bdds, FILE* file) const {
+  std::vector<DdNode*> roots;
+  roots.reserve(bdds.size());
+
+  for (const CUDD::BDD& bdd : bdds) {
+    roots.push_back(bdd.getNode());
+  }
+
+  std::fprintf(file, "bdds %zu\n", bdds.size());
+
+  int stored = Dddmp_cuddBddStoreN(mgr_->getManager(), roots.size(),
+                                   roots.data(), nullptr, nullptr, nullptr,
+                                   DDDMP_MODE_BINARY, DDDMP_VARIDS, nullptr,
+                                   file);
+
+  if (stored != DDDMP_SUCCESS) {
+    throw std::runtime_error("Error: could not write BDDs.");
+  }
+}
+
+std::vector<CUDD::BDD> VarMgr::load_bdds(FILE* file) const {
+  expect_token(file, "bdds");
+  std::size_t bdd_count = read_number(file);
+
+  DdNode** roots = nullptr;
+  int loaded = Dddmp_cuddBddLoadN(mgr_->getManager(), DDDMP_ROOT_MATCHLIST,
+                                  nullptr, DDDMP_VAR_MATCHIDS, nullptr, nullptr,
+                                  nullptr, DDDMP_MODE_DEFAULT, nullptr, file,
+                                  &roots);
+
+  if (loaded < 0 || static_cast<std::size_t>(loaded) != bdd_count) {
+    for (int i = 0; i < loaded; ++i) {
+      Cudd_RecursiveDeref(mgr_->getManager(), roots[i]);
+    }
+    std::free(roots);
+    throw std::runtime_error("Error: could not read BDDs.");
+  }
+
+  std::vector<CUDD::BDD> bdds;
+  bdds.reserve(bdd_count);
+
+  // DDDMP returns referenced roots, which the BDD objects reference again
+  for (std::size_t i = 0; i < bdd_count; ++i) {
+    bdds.emplace_back(*mgr_, roots[i]);
+    Cudd_RecursiveDeref(mgr_->getManager(), roots[i]);
+  }
+  std::free(roots);
+
+  return bdds;
+}
+
 }
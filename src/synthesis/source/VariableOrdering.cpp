@@ -0,0 +1,240 @@
+#include "VariableOrdering.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+#include "Reordering.h"
+#include "Serialization.h"
+
+namespace Syft {
+
+VariableOrdering::VariableOrdering(std::shared_ptr<VarMgr> var_mgr,
+                                   Player starting_player)
+    : var_mgr_(std::move(var_mgr))
+    , starting_player_(starting_player)
+{}
+
+void VariableOrdering::add_automaton(
+    std::size_t automaton_id,
+    const std::vector<std::string>& propositions) {
+  automata_.push_back({automaton_id, propositions});
+}
+
+std::vector<int> VariableOrdering::state_indices(
+    const Automaton& automaton) const {
+  std::vector<int> indices;
+
+  for (const CUDD::BDD& variable :
+         var_mgr_->state_variables(automaton.automaton_id)) {
+    indices.push_back(variable.NodeReadIndex());
+  }
+
+  return indices;
+}
+
+std::vector<int> VariableOrdering::named_indices(
+    const std::vector<std::string>& names) const {
+  std::vector<int> indices;
+
+  for (const std::string& name : names) {
+    indices.push_back(var_mgr_->name_to_variable(name).NodeReadIndex());
+  }
+
+  return indices;
+}
+
+std::vector<int> VariableOrdering::order_propositions() const {
+  std::vector<std::string> names;
+  std::unordered_map<std::string, std::size_t> ids;
+
+  for (const Automaton& automaton : automata_) {
+    for (const std::string& proposition : automaton.propositions) {
+      if (ids.emplace(proposition, names.size()).second) {
+        names.push_back(proposition);
+      }
+    }
+  }
+
+  // Two propositions co-occur once for every automaton reading both
+  std::size_t count = names.size();
+  std::vector<std::vector<std::size_t>> co_occurrences(
+      count, std::vector<std::size_t>(count, 0));
+  std::vector<std::size_t> degrees(count, 0);
+
+  for (const Automaton& automaton : automata_) {
+    for (const std::string& p : automaton.propositions) {
+      for (const std::string& q : automaton.propositions) {
+        if (p == q) continue;
+        ++co_occurrences[ids.at(p)][ids.at(q)];
+        ++degrees[ids.at(p)];
+      }
+    }
+  }
+
+  // Greedily appends the proposition co-occurring the most with those already
+  // placed, starting from the one co-occurring the most overall
+  std::vector<std::string> ordered_names;
+  std::vector<std::size_t> affinities(count, 0);
+  std::vector<bool> placed(count, false);
+
+  while (ordered_names.size() < count) {
+    std::size_t best = count;
+
+    for (std::size_t i = 0; i < count; ++i) {
+      if (placed[i]) continue;
+
+      if (best == count || affinities[i] > affinities[best] ||
+          (affinities[i] == affinities[best] && degrees[i] > degrees[best])) {
+        best = i;
+      }
+    }
+
+    placed[best] = true;
+    ordered_names.push_back(names[best]);
+
+    for (std::size_t i = 0; i < count; ++i) {
+      affinities[i] += co_occurrences[best][i];
+    }
+  }
+
+  return named_indices(ordered_names);
+}
+
+std::vector<int> VariableOrdering::compute(VariableOrder order) const {
+  std::vector<int> current_order = var_mgr_->variable_order();
+
+  if (order == VariableOrder::Creation) {
+    return current_order;
+  }
+
+  std::vector<int> new_order;
+  std::vector<bool> placed(current_order.size(), false);
+
+  auto place = [&](const std::vector<int>& indices) {
+    for (int index : indices) {
+      if (!placed[index]) {
+        placed[index] = true;
+        new_order.push_back(index);
+      }
+    }
+  };
+
+  switch (order) {
+    case VariableOrder::StateBitsOnTop:
+      for (const Automaton& automaton : automata_) {
+        place(state_indices(automaton));
+      }
+      break;
+
+    case VariableOrder::Interleaved: {
+      std::vector<std::vector<int>> automaton_indices;
+      std::size_t max_size = 0;
+
+      for (const Automaton& automaton : automata_) {
+        automaton_indices.push_back(state_indices(automaton));
+        max_size = std::max(max_size, automaton_indices.back().size());
+      }
+
+      for (std::size_t i = 0; i < max_size; ++i) {
+        for (const std::vector<int>& indices : automaton_indices) {
+          if (i < indices.size()) place({indices[i]});
+        }
+      }
+      break;
+    }
+
+    case VariableOrder::PlayerTurn: {
+      for (const Automaton& automaton : automata_) {
+        place(state_indices(automaton));
+      }
+
+      std::vector<int> inputs =
+        named_indices(var_mgr_->input_variable_labels());
+      std::vector<int> outputs =
+        named_indices(var_mgr_->output_variable_labels());
+
+      if (starting_player_ == Player::Environment) {
+        place(inputs);
+        place(outputs);
+      } else {
+        place(outputs);
+        place(inputs);
+      }
+      break;
+    }
+
+    case VariableOrder::FormulaStructure: {
+      std::vector<int> propositions = order_propositions();
+      std::unordered_map<int, std::size_t> positions;
+      for (std::size_t i = 0; i < propositions.size(); ++i) {
+        positions[propositions[i]] = i;
+      }
+
+      // Each automaton goes right above the first proposition it reads
+      std::vector<std::vector<const Automaton*>> automata_above(
+          propositions.size());
+
+      for (const Automaton& automaton : automata_) {
+        std::vector<int> read = named_indices(automaton.propositions);
+
+        if (read.empty()) {
+          place(state_indices(automaton));
+        } else {
+          std::size_t first = propositions.size();
+          for (int index : read) {
+            first = std::min(first, positions.at(index));
+          }
+          automata_above[first].push_back(&automaton);
+        }
+      }
+
+      for (std::size_t i = 0; i < propositions.size(); ++i) {
+        for (const Automaton* automaton : automata_above[i]) {
+          place(state_indices(*automaton));
+        }
+        place({propositions[i]});
+      }
+      break;
+    }
+
+    case VariableOrder::Creation:
+      break;
+  }
+
+  place(current_order);
+
+  return new_order;
+}
+
+void VariableOrdering::apply(const SynthesisOptions& options) const {
+  if (!options.variable_order_file.empty()) {
+    FilePointer file = open_file(options.variable_order_file, "r");
+    var_mgr_->set_variable_order(var_mgr_->read_variable_order(file.get()));
+  } else if (options.variable_order != VariableOrder::Creation) {
+    var_mgr_->set_variable_order(compute(options.variable_order));
+  }
+
+  std::shared_ptr<CUDD::Cudd> mgr = var_mgr_->cudd_mgr();
+
+  if (options.group_automaton_variables) {
+    for (const Automaton& automaton : automata_) {
+      std::vector<int> levels;
+      for (int index : state_indices(automaton)) {
+        levels.push_back(mgr->ReadPerm(index));
+      }
+
+      if (levels.empty()) continue;
+
+      auto bounds = std::minmax_element(levels.begin(), levels.end());
+      if ((std::size_t) (*bounds.second - *bounds.first + 1) == levels.size()) {
+        var_mgr_->group_state_variables(automaton.automaton_id);
+      }
+    }
+  }
+
+  if (options.reorder_after_arena) {
+    reorder_variables(*mgr, options);
+  }
+}
+
+}